@@ -0,0 +1,98 @@
+package fltk_go
+
+/*
+#include "image.h"
+*/
+import "C"
+import (
+	"errors"
+	"sort"
+	"unsafe"
+
+	"github.com/george012/fltk_go/assetbundle"
+)
+
+var ErrAssetNotFound = errors.New("asset not found")
+
+// AssetBundle gives access to the images of a bundle written by the
+// assetbundle package. The file is memory mapped where the platform allows
+// it: raw images are drawn straight from the mapping without being copied or
+// decoded, and QOI images are decoded from it on demand.
+type AssetBundle struct {
+	data    []byte
+	release func() error
+	entries map[string]assetbundle.Entry
+}
+
+func OpenAssetBundle(path string) (*AssetBundle, error) {
+	data, release, err := mapAssetFile(path)
+	if err != nil {
+		return nil, err
+	}
+	entries, err := assetbundle.ReadIndex(data)
+	if err != nil {
+		release()
+		return nil, err
+	}
+	b := &AssetBundle{data: data, release: release, entries: make(map[string]assetbundle.Entry, len(entries))}
+	for _, e := range entries {
+		b.entries[e.Name] = e
+	}
+	return b, nil
+}
+
+// Names returns the names of all images in the bundle, sorted.
+func (b *AssetBundle) Names() []string {
+	names := make([]string, 0, len(b.entries))
+	for name := range b.entries {
+		names = append(names, name)
+	}
+	sort.Strings(names)
+	return names
+}
+
+func (b *AssetBundle) Has(name string) bool {
+	_, ok := b.entries[name]
+	return ok
+}
+
+// Image creates an image for the named asset. Images of raw entries refer
+// to the bundle's memory, so they must be destroyed before the bundle is
+// closed.
+func (b *AssetBundle) Image(name string) (*RgbImage, error) {
+	if b.data == nil {
+		return nil, ErrImageFileAccess
+	}
+	e, ok := b.entries[name]
+	if !ok {
+		return nil, ErrAssetNotFound
+	}
+	if e.Size == 0 {
+		return nil, ErrNoImage
+	}
+	bits := (*C.uchar)(unsafe.Pointer(&b.data[e.Offset]))
+	img := &RgbImage{}
+	switch e.Format {
+	case assetbundle.Raw:
+		initImage(img, unsafe.Pointer(C.go_fltk_rgb_image_view(bits, C.int(e.Width), C.int(e.Height), C.int(e.Depth), 0)))
+	case assetbundle.QOI:
+		initImage(img, unsafe.Pointer(C.go_fltk_qoi_image_data(bits, C.int(e.Size))))
+	default:
+		return nil, ErrImageDecodingFailed
+	}
+	if err := image_error(img.fail()); err != nil {
+		img.Destroy()
+		return nil, err
+	}
+	return img, nil
+}
+
+// Close releases the bundle's memory. Images created from raw entries must
+// have been destroyed before.
+func (b *AssetBundle) Close() error {
+	if b.data == nil {
+		return nil
+	}
+	b.data = nil
+	return b.release()
+}
@@ -0,0 +1,30 @@
+//go:build !windows
+
+package fltk_go
+
+import (
+	"os"
+	"syscall"
+)
+
+// mapAssetFile maps the file read-only. The mapping lives outside of the Go
+// heap, so FLTK images may keep pointing into it.
+func mapAssetFile(path string) ([]byte, func() error, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, nil, err
+	}
+	defer f.Close()
+	info, err := f.Stat()
+	if err != nil {
+		return nil, nil, err
+	}
+	if info.Size() == 0 {
+		return nil, nil, ErrImageDecodingFailed
+	}
+	data, err := syscall.Mmap(int(f.Fd()), 0, int(info.Size()), syscall.PROT_READ, syscall.MAP_SHARED)
+	if err != nil {
+		return nil, nil, err
+	}
+	return data, func() error { return syscall.Munmap(data) }, nil
+}
@@ -0,0 +1,26 @@
+package fltk_go
+
+/*
+#include <stdlib.h>
+*/
+import "C"
+import (
+	"os"
+	"unsafe"
+)
+
+// mapAssetFile reads the file into C memory, which FLTK images may keep
+// pointing into, unlike the Go heap.
+func mapAssetFile(path string) ([]byte, func() error, error) {
+	content, err := os.ReadFile(path)
+	if err != nil {
+		return nil, nil, err
+	}
+	if len(content) == 0 {
+		return nil, nil, ErrImageDecodingFailed
+	}
+	ptr := C.malloc(C.size_t(len(content)))
+	data := unsafe.Slice((*byte)(ptr), len(content))
+	copy(data, content)
+	return data, func() error { C.free(ptr); return nil }, nil
+}
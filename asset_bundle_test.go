@@ -0,0 +1,58 @@
+package fltk_go
+
+import (
+	"bytes"
+	goimage "image"
+	"image/color"
+	"image/png"
+	"testing"
+
+	"github.com/george012/fltk_go/assetbundle"
+)
+
+// qoiTestImage has rows made of runs longer than a QOI run chunk, of two
+// alternating colors found in the color index, of small and larger color
+// steps, and of alpha changes.
+func qoiTestImage() *goimage.NRGBA {
+	const w = 100
+	img := goimage.NewNRGBA(goimage.Rect(0, 0, w, 5))
+	for x := 0; x < w; x++ {
+		img.SetNRGBA(x, 0, color.NRGBA{10, 20, 30, 255})
+		if x%2 == 0 {
+			img.SetNRGBA(x, 1, color.NRGBA{200, 0, 0, 255})
+		} else {
+			img.SetNRGBA(x, 1, color.NRGBA{0, 0, 200, 255})
+		}
+		img.SetNRGBA(x, 2, color.NRGBA{uint8(x), uint8(x), uint8(x + x%2), 255})
+		img.SetNRGBA(x, 3, color.NRGBA{uint8(x * 5), uint8(x * 9), uint8(x * 13), 255})
+		img.SetNRGBA(x, 4, color.NRGBA{uint8(x * 31), 7, uint8(x), uint8(x * 2)})
+	}
+	return img
+}
+
+func TestQoiDecoderRoundTrip(t *testing.T) {
+	want := qoiTestImage()
+	img, err := NewQoiImageFromData(assetbundle.EncodeQOI(want))
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer img.Destroy()
+	if img.DataW() != want.Rect.Dx() || img.DataH() != want.Rect.Dy() || img.D() != 4 {
+		t.Fatalf("decoded %dx%dx%d", img.DataW(), img.DataH(), img.D())
+	}
+	var buf bytes.Buffer
+	if err := img.EncodePNG(&buf, 1); err != nil {
+		t.Fatal(err)
+	}
+	got, err := png.Decode(&buf)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for y := 0; y < want.Rect.Dy(); y++ {
+		for x := 0; x < want.Rect.Dx(); x++ {
+			if g, w := color.NRGBAModel.Convert(got.At(x, y)), want.NRGBAAt(x, y); g != w {
+				t.Fatalf("pixel %d,%d is %v, want %v", x, y, g, w)
+			}
+		}
+	}
+}
@@ -0,0 +1,226 @@
+// Package assetbundle reads and writes image asset bundles: many images
+// packed into one indexed file that an application maps into memory at
+// startup instead of decoding individual PNG files.
+//
+// Layout, all integers little endian:
+//
+//	header  magic "FLASSET1", entry count u32, index size u32
+//	index   per entry: name length u16, name, format u8, depth u8,
+//	        width u32, height u32, offset u64, size u64
+//	data    entry payloads, each aligned to 16 bytes
+//
+// Raw entries hold uncompressed 8 bit pixels with non-premultiplied alpha,
+// the layout FLTK's RGB images use, so they can be drawn straight from the
+// mapped file. QOI entries are compressed and decoded on load.
+package assetbundle
+
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"image"
+	"image/png"
+	"io"
+	"math"
+	"math/bits"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+)
+
+const magic = "FLASSET1"
+
+const (
+	headerSize = 16
+	alignment  = 16
+	// an index record without its name
+	recordSize = 2 + 26
+)
+
+type Format uint8
+
+const (
+	// Raw is uncompressed RGBA, usable without any decoding.
+	Raw Format = iota
+	// QOI is compressed with the fast QOI codec.
+	QOI
+)
+
+var ErrInvalidBundle = errors.New("invalid asset bundle")
+
+type Entry struct {
+	Name   string
+	Format Format
+	Depth  int
+	Width  int
+	Height int
+	Offset int64
+	Size   int64
+}
+
+// ReadIndex parses the index at the start of a bundle.
+func ReadIndex(data []byte) ([]Entry, error) {
+	if len(data) < headerSize || string(data[:8]) != magic {
+		return nil, ErrInvalidBundle
+	}
+	count := uint64(binary.LittleEndian.Uint32(data[8:]))
+	indexSize := uint64(binary.LittleEndian.Uint32(data[12:]))
+	if indexSize > uint64(len(data)-headerSize) || count > indexSize/recordSize {
+		return nil, ErrInvalidBundle
+	}
+	index := data[headerSize : headerSize+indexSize]
+	entries := make([]Entry, 0, count)
+	for i := uint64(0); i < count; i++ {
+		if len(index) < 2 {
+			return nil, ErrInvalidBundle
+		}
+		nameLen := int(binary.LittleEndian.Uint16(index))
+		if len(index) < 2+nameLen+26 {
+			return nil, ErrInvalidBundle
+		}
+		rec := index[2+nameLen:]
+		name := string(index[2 : 2+nameLen])
+		width := uint64(binary.LittleEndian.Uint32(rec[2:]))
+		height := uint64(binary.LittleEndian.Uint32(rec[6:]))
+		offset := binary.LittleEndian.Uint64(rec[10:])
+		size := binary.LittleEndian.Uint64(rec[18:])
+		if width > math.MaxInt32 || height > math.MaxInt32 {
+			return nil, fmt.Errorf("%w: entry %q too large", ErrInvalidBundle, name)
+		}
+		if offset > uint64(len(data)) || size > uint64(len(data))-offset {
+			return nil, fmt.Errorf("%w: entry %q out of bounds", ErrInvalidBundle, name)
+		}
+		e := Entry{
+			Name:   name,
+			Format: Format(rec[0]),
+			Depth:  int(rec[1]),
+			Width:  int(width),
+			Height: int(height),
+			Offset: int64(offset),
+			Size:   int64(size),
+		}
+		if e.Depth < 1 || e.Depth > 4 {
+			return nil, fmt.Errorf("%w: entry %q has depth %d", ErrInvalidBundle, name, e.Depth)
+		}
+		// width*height fits in 64 bits, times the depth may not
+		if hi, lo := bits.Mul64(width*height, uint64(e.Depth)); e.Format == Raw && (hi != 0 || lo > size) {
+			return nil, fmt.Errorf("%w: entry %q too short", ErrInvalidBundle, name)
+		}
+		entries = append(entries, e)
+		index = rec[26:]
+	}
+	return entries, nil
+}
+
+type asset struct {
+	name  string
+	image image.Image
+}
+
+// Writer collects images and writes them as a bundle.
+type Writer struct {
+	format Format
+	assets []asset
+}
+
+func NewWriter(format Format) *Writer {
+	return &Writer{format: format}
+}
+
+func (w *Writer) Add(name string, img image.Image) {
+	w.assets = append(w.assets, asset{name, img})
+}
+
+// AddDir adds all PNG files below dir, named by their slash separated path
+// relative to dir.
+func (w *Writer) AddDir(dir string) error {
+	return filepath.Walk(dir, func(path string, info os.FileInfo, err error) error {
+		if err != nil || info.IsDir() || !strings.EqualFold(filepath.Ext(path), ".png") {
+			return err
+		}
+		f, err := os.Open(path)
+		if err != nil {
+			return err
+		}
+		defer f.Close()
+		img, err := png.Decode(f)
+		if err != nil {
+			return fmt.Errorf("%s: %w", path, err)
+		}
+		rel, err := filepath.Rel(dir, path)
+		if err != nil {
+			return err
+		}
+		w.Add(filepath.ToSlash(rel), img)
+		return nil
+	})
+}
+
+// WriteTo writes the bundle, with entries sorted by name.
+func (w *Writer) WriteTo(out io.Writer) (int64, error) {
+	sort.Slice(w.assets, func(i, j int) bool { return w.assets[i].name < w.assets[j].name })
+	payloads := make([][]byte, len(w.assets))
+	entries := make([]Entry, len(w.assets))
+	indexSize := 0
+	for i, a := range w.assets {
+		if len(a.name) > 0xffff {
+			return 0, fmt.Errorf("asset name too long: %q", a.name[:64])
+		}
+		nrgba := toNRGBA(a.image)
+		e := Entry{Name: a.name, Format: w.format, Depth: 4, Width: nrgba.Rect.Dx(), Height: nrgba.Rect.Dy()}
+		if w.format == QOI {
+			payloads[i] = EncodeQOI(nrgba)
+		} else {
+			payloads[i] = nrgba.Pix
+		}
+		e.Size = int64(len(payloads[i]))
+		entries[i] = e
+		indexSize += 2 + len(a.name) + 26
+	}
+	offset := alignUp(int64(headerSize + indexSize))
+	for i := range entries {
+		entries[i].Offset = offset
+		offset = alignUp(offset + entries[i].Size)
+	}
+
+	buf := make([]byte, headerSize+indexSize)
+	le := binary.LittleEndian
+	copy(buf, magic)
+	le.PutUint32(buf[8:], uint32(len(entries)))
+	le.PutUint32(buf[12:], uint32(indexSize))
+	rec := buf[headerSize:]
+	for _, e := range entries {
+		le.PutUint16(rec, uint16(len(e.Name)))
+		rec = rec[2+copy(rec[2:], e.Name):]
+		rec[0], rec[1] = byte(e.Format), byte(e.Depth)
+		le.PutUint32(rec[2:], uint32(e.Width))
+		le.PutUint32(rec[6:], uint32(e.Height))
+		le.PutUint64(rec[10:], uint64(e.Offset))
+		le.PutUint64(rec[18:], uint64(e.Size))
+		rec = rec[26:]
+	}
+	written := int64(0)
+	write := func(b []byte) error {
+		n, err := out.Write(b)
+		written += int64(n)
+		return err
+	}
+	if err := write(buf); err != nil {
+		return written, err
+	}
+	var pad [alignment]byte
+	for i, e := range entries {
+		if err := write(pad[:e.Offset-written]); err != nil {
+			return written, err
+		}
+		if err := write(payloads[i]); err != nil {
+			return written, err
+		}
+	}
+	return written, nil
+}
+
+func alignUp(n int64) int64 {
+	return (n + alignment - 1) / alignment * alignment
+}
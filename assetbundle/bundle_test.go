@@ -0,0 +1,115 @@
+package assetbundle
+
+import (
+	"bytes"
+	"encoding/binary"
+	"image"
+	"image/color"
+	"math"
+	"testing"
+)
+
+func testImage(w, h int) *image.NRGBA {
+	img := image.NewNRGBA(image.Rect(0, 0, w, h))
+	for y := 0; y < h; y++ {
+		for x := 0; x < w; x++ {
+			img.SetNRGBA(x, y, color.NRGBA{uint8(x * 7), uint8(y * 3), uint8(x / 4), uint8(255 - x%3*100)})
+		}
+	}
+	return img
+}
+
+func TestWriteAndReadIndex(t *testing.T) {
+	for _, format := range []Format{Raw, QOI} {
+		w := NewWriter(format)
+		w.Add("icons/b.png", testImage(3, 5))
+		w.Add("icons/a.png", testImage(16, 16))
+		var buf bytes.Buffer
+		if _, err := w.WriteTo(&buf); err != nil {
+			t.Fatal(err)
+		}
+		entries, err := ReadIndex(buf.Bytes())
+		if err != nil {
+			t.Fatal(err)
+		}
+		if len(entries) != 2 || entries[0].Name != "icons/a.png" || entries[1].Name != "icons/b.png" {
+			t.Fatalf("unexpected entries %+v", entries)
+		}
+		for _, e := range entries {
+			if e.Offset%alignment != 0 {
+				t.Errorf("%s is not aligned: %d", e.Name, e.Offset)
+			}
+		}
+		a := entries[0]
+		if a.Width != 16 || a.Height != 16 || a.Depth != 4 || a.Format != format {
+			t.Errorf("unexpected entry %+v", a)
+		}
+		if format == Raw && !bytes.Equal(buf.Bytes()[a.Offset:a.Offset+a.Size], testImage(16, 16).Pix) {
+			t.Errorf("raw pixels differ")
+		}
+	}
+}
+
+func TestReadIndexRejectsGarbage(t *testing.T) {
+	if _, err := ReadIndex([]byte("not a bundle at all")); err == nil {
+		t.Error("expected an error")
+	}
+}
+
+// corrupt returns a one entry bundle with the record of the entry changed
+// by patch, which gets the record after the name.
+func corrupt(t *testing.T, format Format, patch func(header, rec []byte)) []byte {
+	w := NewWriter(format)
+	w.Add("a", testImage(4, 4))
+	var buf bytes.Buffer
+	if _, err := w.WriteTo(&buf); err != nil {
+		t.Fatal(err)
+	}
+	data := buf.Bytes()
+	patch(data[:headerSize], data[headerSize+2+len("a"):])
+	return data
+}
+
+func TestReadIndexRejectsCorruptEntries(t *testing.T) {
+	for _, c := range []struct {
+		name  string
+		patch func(header, rec []byte)
+	}{
+		{"huge count", func(header, rec []byte) {
+			binary.LittleEndian.PutUint32(header[8:], 0xffffffff)
+		}},
+		{"count past the index", func(header, rec []byte) {
+			binary.LittleEndian.PutUint32(header[8:], 2)
+		}},
+		{"offset past the end", func(header, rec []byte) {
+			binary.LittleEndian.PutUint64(rec[10:], 1<<40)
+		}},
+		{"overflowing end", func(header, rec []byte) {
+			binary.LittleEndian.PutUint64(rec[10:], 16)
+			binary.LittleEndian.PutUint64(rec[18:], math.MaxUint64-8)
+		}},
+		{"negative offset", func(header, rec []byte) {
+			binary.LittleEndian.PutUint64(rec[10:], 1<<63)
+		}},
+		{"depth 0", func(header, rec []byte) {
+			rec[1] = 0
+		}},
+		{"depth 5", func(header, rec []byte) {
+			rec[1] = 5
+		}},
+		{"overflowing pixel size", func(header, rec []byte) {
+			binary.LittleEndian.PutUint32(rec[2:], 0x7fffffff)
+			binary.LittleEndian.PutUint32(rec[6:], 0x7fffffff)
+		}},
+		{"too wide", func(header, rec []byte) {
+			binary.LittleEndian.PutUint32(rec[2:], 0xffffffff)
+		}},
+	} {
+		if _, err := ReadIndex(corrupt(t, Raw, c.patch)); err == nil {
+			t.Errorf("%s: expected an error", c.name)
+		}
+	}
+	if _, err := ReadIndex(corrupt(t, Raw, func(header, rec []byte) {})); err != nil {
+		t.Errorf("unpatched bundle: %v", err)
+	}
+}
@@ -0,0 +1,77 @@
+package assetbundle
+
+import (
+	"encoding/binary"
+	"image"
+	"image/draw"
+)
+
+// EncodeQOI encodes the image in the QOI format (https://qoiformat.org),
+// which FLTK decodes several times faster than PNG.
+func EncodeQOI(img image.Image) []byte {
+	nrgba := toNRGBA(img)
+	w, h := nrgba.Rect.Dx(), nrgba.Rect.Dy()
+	out := make([]byte, 14, 14+w*h+8)
+	copy(out, "qoif")
+	binary.BigEndian.PutUint32(out[4:], uint32(w))
+	binary.BigEndian.PutUint32(out[8:], uint32(h))
+	out[12] = 4 // channels
+	out[13] = 0 // sRGB with linear alpha
+
+	var index [64][4]byte
+	prev := [4]byte{0, 0, 0, 255}
+	run := 0
+	for y := 0; y < h; y++ {
+		row := nrgba.Pix[y*nrgba.Stride : y*nrgba.Stride+4*w]
+		for x := 0; x < w; x++ {
+			var px [4]byte
+			copy(px[:], row[4*x:4*x+4])
+			last := y == h-1 && x == w-1
+			if px == prev {
+				run++
+				if run == 62 || last {
+					out = append(out, 0xc0|byte(run-1))
+					run = 0
+				}
+				continue
+			}
+			if run > 0 {
+				out = append(out, 0xc0|byte(run-1))
+				run = 0
+			}
+			hash := (int(px[0])*3 + int(px[1])*5 + int(px[2])*7 + int(px[3])*11) % 64
+			switch {
+			case index[hash] == px:
+				out = append(out, byte(hash))
+			case px[3] != prev[3]:
+				out = append(out, 0xff, px[0], px[1], px[2], px[3])
+			default:
+				vr := int8(px[0] - prev[0])
+				vg := int8(px[1] - prev[1])
+				vb := int8(px[2] - prev[2])
+				vgr, vgb := vr-vg, vb-vg
+				switch {
+				case vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2:
+					out = append(out, 0x40|byte(vr+2)<<4|byte(vg+2)<<2|byte(vb+2))
+				case vgr > -9 && vgr < 8 && vg > -33 && vg < 32 && vgb > -9 && vgb < 8:
+					out = append(out, 0x80|byte(vg+32), byte(vgr+8)<<4|byte(vgb+8))
+				default:
+					out = append(out, 0xfe, px[0], px[1], px[2])
+				}
+			}
+			index[hash] = px
+			prev = px
+		}
+	}
+	return append(out, 0, 0, 0, 0, 0, 0, 0, 1)
+}
+
+func toNRGBA(img image.Image) *image.NRGBA {
+	if nrgba, ok := img.(*image.NRGBA); ok && nrgba.Rect.Min == (image.Point{}) {
+		return nrgba
+	}
+	b := img.Bounds()
+	nrgba := image.NewNRGBA(image.Rect(0, 0, b.Dx(), b.Dy()))
+	draw.Draw(nrgba, nrgba.Rect, img, b.Min, draw.Src)
+	return nrgba
+}
@@ -0,0 +1,196 @@
+package binding
+
+import (
+	"sync"
+	"sync/atomic"
+
+	"github.com/george012/fltk_go"
+)
+
+type dirtyBinding interface {
+	apply()
+}
+
+// Binder applies changed bindings to their widgets once per event loop
+// iteration, right before FLTK redraws. It must be created and closed on the
+// UI thread. Values bound through it may be set from other goroutines if
+// fltk_go.Lock was called, as the binder then wakes the event loop itself.
+type Binder struct {
+	mu     sync.Mutex
+	dirty  []dirtyBinding
+	queued map[dirtyBinding]bool
+	waking bool
+	closed bool
+	remove func()
+}
+
+func NewBinder() *Binder {
+	b := &Binder{queued: make(map[dirtyBinding]bool)}
+	b.remove = fltk_go.AddCheck(b.Flush)
+	return b
+}
+
+func (b *Binder) markDirty(d dirtyBinding) {
+	b.mu.Lock()
+	if b.closed || b.queued[d] {
+		b.mu.Unlock()
+		return
+	}
+	b.queued[d] = true
+	b.dirty = append(b.dirty, d)
+	wake := !b.waking
+	b.waking = true
+	b.mu.Unlock()
+	if wake {
+		fltk_go.AwakeNullMessage()
+	}
+}
+
+// Flush applies the pending changes now. It is called automatically once per
+// event loop iteration.
+func (b *Binder) Flush() {
+	b.mu.Lock()
+	dirty := b.dirty
+	b.dirty = nil
+	for _, d := range dirty {
+		delete(b.queued, d)
+	}
+	b.waking = false
+	b.mu.Unlock()
+	for _, d := range dirty {
+		d.apply()
+	}
+}
+
+// Close stops applying changes. Bindings are not closed from their values;
+// call the unbind functions for values that outlive the binder.
+func (b *Binder) Close() {
+	b.mu.Lock()
+	b.closed = true
+	b.dirty = nil
+	b.mu.Unlock()
+	b.remove()
+}
+
+// widget is the part of the widgets of fltk_go telling whether they were
+// destroyed.
+type widget interface {
+	Exists() bool
+}
+
+type binding[T comparable] struct {
+	value *Value[T]
+	set   func(T)
+	// the widget of set, nil for Bind
+	widget widget
+	unbind func()
+	// set once unbind was called, as the binding may still be queued
+	unbound int32
+	last    T
+	applied bool
+}
+
+func (d *binding[T]) apply() {
+	if atomic.LoadInt32(&d.unbound) != 0 {
+		return
+	}
+	if d.widget != nil && !d.widget.Exists() {
+		// setting a property of a destroyed widget panics
+		d.unbind()
+		return
+	}
+	v := d.value.Get()
+	if d.applied && v == d.last {
+		return
+	}
+	d.last, d.applied = v, true
+	d.set(v)
+}
+
+// Bind calls set with the value of v now and, from then on, with its latest
+// value at the end of every event loop iteration in which it changed to
+// something other than what was last passed to set. The bindings of the
+// widget properties below are dropped once their widget is destroyed; set
+// must handle that itself.
+func Bind[T comparable](b *Binder, v *Value[T], set func(T)) (unbind func()) {
+	return bind(b, v, nil, set)
+}
+
+// bind binds a property of w, dropping the binding once w is destroyed.
+func bind[T comparable](b *Binder, v *Value[T], w widget, set func(T)) (unbind func()) {
+	d := &binding[T]{value: v, set: set, widget: w}
+	// cancelling an observer twice is harmless
+	cancel := v.Observe(func() { b.markDirty(d) })
+	d.unbind = func() {
+		atomic.StoreInt32(&d.unbound, 1)
+		cancel()
+	}
+	d.apply()
+	return d.unbind
+}
+
+// Label binds the widget's label.
+func (b *Binder) Label(w interface {
+	widget
+	SetLabel(string)
+}, v *Value[string]) (unbind func()) {
+	return bind(b, v, w, w.SetLabel)
+}
+
+// Value binds the value of a valuator, progress bar or spinner.
+func (b *Binder) Value(w interface {
+	widget
+	SetValue(float64)
+}, v *Value[float64]) (unbind func()) {
+	return bind(b, v, w, w.SetValue)
+}
+
+// Text binds the value of an input.
+func (b *Binder) Text(w interface {
+	widget
+	SetValue(string) bool
+}, v *Value[string]) (unbind func()) {
+	return bind(b, v, w, func(s string) { w.SetValue(s) })
+}
+
+// Color binds the widget's color.
+func (b *Binder) Color(w interface {
+	widget
+	SetColor(fltk_go.Color)
+	Redraw()
+}, v *Value[fltk_go.Color]) (unbind func()) {
+	return bind(b, v, w, func(c fltk_go.Color) {
+		w.SetColor(c)
+		w.Redraw()
+	})
+}
+
+// Visible binds whether the widget is shown.
+func (b *Binder) Visible(w interface {
+	widget
+	Show()
+	Hide()
+}, v *Value[bool]) (unbind func()) {
+	return bind(b, v, w, func(visible bool) {
+		if visible {
+			w.Show()
+		} else {
+			w.Hide()
+		}
+	})
+}
+
+// Active binds whether the widget is active.
+func (b *Binder) Active(w interface {
+	widget
+	Activate()
+	Deactivate()
+}, v *Value[bool]) (unbind func()) {
+	return bind(b, v, w, func(active bool) {
+		if active {
+			w.Activate()
+		} else {
+			w.Deactivate()
+		}
+	})
+}
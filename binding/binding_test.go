@@ -0,0 +1,125 @@
+package binding
+
+import (
+	"testing"
+)
+
+func TestValue(t *testing.T) {
+	v := NewValue(1)
+	calls := 0
+	cancel := v.Observe(func() { calls++ })
+	v.Set(2)
+	v.Set(2)
+	if v.Get() != 2 || calls != 1 {
+		t.Errorf("got %d after %d notifications, want 2 after 1", v.Get(), calls)
+	}
+	cancel()
+	v.Set(3)
+	if calls != 1 {
+		t.Errorf("cancelled observer notified")
+	}
+}
+
+func TestMap(t *testing.T) {
+	src := NewValue(2)
+	dst := Map(src, func(v int) bool { return v > 5 })
+	if dst.Get() {
+		t.Errorf("derived value is true for 2")
+	}
+	src.Set(6)
+	if !dst.Get() {
+		t.Errorf("derived value did not follow its source")
+	}
+	dst.Close()
+	if len(src.observers) != 0 {
+		t.Errorf("closed derived value still observes its source")
+	}
+	src.Set(1)
+	if !dst.Get() {
+		t.Errorf("closed derived value followed its source")
+	}
+}
+
+// newTestBinder returns a binder that is flushed by hand
+func newTestBinder() *Binder {
+	return &Binder{queued: make(map[dirtyBinding]bool), remove: func() {}}
+}
+
+func TestBindAppliesChangesOncePerFlush(t *testing.T) {
+	b := newTestBinder()
+	v := NewValue("a")
+	var set []string
+	Bind(b, v, func(s string) { set = append(set, s) })
+	v.Set("b")
+	v.Set("c")
+	b.Flush()
+	// set back to what was applied: nothing to do
+	v.Set("d")
+	v.Set("c")
+	b.Flush()
+	if len(set) != 2 || set[0] != "a" || set[1] != "c" {
+		t.Errorf("set with %q, want [a c]", set)
+	}
+	if len(b.dirty) != 0 || len(b.queued) != 0 {
+		t.Errorf("flushed binder still has dirty bindings")
+	}
+}
+
+func TestUnbindDropsQueuedChange(t *testing.T) {
+	b := newTestBinder()
+	v := NewValue(1)
+	var set []int
+	unbind := Bind(b, v, func(i int) { set = append(set, i) })
+	v.Set(2)
+	unbind()
+	b.Flush()
+	if len(set) != 1 || set[0] != 1 {
+		t.Errorf("set with %v after unbinding, want [1]", set)
+	}
+}
+
+type testWidget struct {
+	exists bool
+	label  string
+}
+
+func (w *testWidget) Exists() bool { return w.exists }
+func (w *testWidget) SetLabel(label string) {
+	if !w.exists {
+		panic("destroyed")
+	}
+	w.label = label
+}
+
+func TestBindingDroppedWithItsWidget(t *testing.T) {
+	b := newTestBinder()
+	v := NewValue("a")
+	w := &testWidget{exists: true}
+	b.Label(w, v)
+	if w.label != "a" {
+		t.Errorf("label %q, want a", w.label)
+	}
+	w.exists = false
+	v.Set("b")
+	b.Flush()
+	if len(v.observers) != 0 {
+		t.Errorf("binding of a destroyed widget still observes its value")
+	}
+	v.Set("c")
+	if len(b.dirty) != 0 {
+		t.Errorf("binding of a destroyed widget marked dirty")
+	}
+}
+
+func TestClosedBinderIgnoresChanges(t *testing.T) {
+	b := newTestBinder()
+	v := NewValue(0)
+	calls := 0
+	Bind(b, v, func(int) { calls++ })
+	b.Close()
+	v.Set(1)
+	b.Flush()
+	if calls != 1 {
+		t.Errorf("closed binder applied a change")
+	}
+}
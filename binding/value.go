@@ -0,0 +1,87 @@
+// Package binding connects observable values to widget properties. Changes
+// are not applied when a value is set but collected by a Binder, which
+// applies each changed binding once per event loop iteration and only if
+// its value differs from what the widget already shows. Setting a label ten
+// times while handling one event therefore updates the widget once, and
+// setting it back to what it was does not touch the widget at all.
+package binding
+
+import "sync"
+
+// Value is an observable value. It may be read and set from any goroutine.
+type Value[T comparable] struct {
+	mu        sync.Mutex
+	value     T
+	observers map[int]func()
+	nextID    int
+	// stops following the source of a value made by Map
+	unfollow func()
+}
+
+func NewValue[T comparable](initial T) *Value[T] {
+	return &Value[T]{value: initial}
+}
+
+func (v *Value[T]) Get() T {
+	v.mu.Lock()
+	defer v.mu.Unlock()
+	return v.value
+}
+
+// Set changes the value and notifies the observers, unless it is unchanged.
+func (v *Value[T]) Set(value T) {
+	v.mu.Lock()
+	if value == v.value {
+		v.mu.Unlock()
+		return
+	}
+	v.value = value
+	observers := make([]func(), 0, len(v.observers))
+	for _, fn := range v.observers {
+		observers = append(observers, fn)
+	}
+	v.mu.Unlock()
+	for _, fn := range observers {
+		fn()
+	}
+}
+
+// Observe calls fn after every change of the value until the returned
+// function is called.
+func (v *Value[T]) Observe(fn func()) (cancel func()) {
+	v.mu.Lock()
+	defer v.mu.Unlock()
+	if v.observers == nil {
+		v.observers = make(map[int]func())
+	}
+	v.nextID++
+	id := v.nextID
+	v.observers[id] = fn
+	return func() {
+		v.mu.Lock()
+		delete(v.observers, id)
+		v.mu.Unlock()
+	}
+}
+
+// Map returns a value derived from src with f, kept up to date as src
+// changes until it is closed.
+func Map[T, U comparable](src *Value[T], f func(T) U) *Value[U] {
+	dst := NewValue(f(src.Get()))
+	dst.unfollow = src.Observe(func() {
+		dst.Set(f(src.Get()))
+	})
+	return dst
+}
+
+// Close stops a value made by Map from following its source, which
+// otherwise keeps it alive. It does nothing for other values.
+func (v *Value[T]) Close() {
+	v.mu.Lock()
+	unfollow := v.unfollow
+	v.unfollow = nil
+	v.mu.Unlock()
+	if unfollow != nil {
+		unfollow()
+	}
+}
@@ -0,0 +1,268 @@
+#include "box_cache.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include <FL/Fl.H>
+#include <FL/Fl_Graphics_Driver.H>
+#include <FL/Fl_Image_Surface.H>
+#include <FL/Fl_RGB_Image.H>
+#include <FL/fl_draw.H>
+
+// The box cache draws box types from pre-rendered slices: a box of a given
+// type, color and height is rasterized once with its original draw function,
+// then drawn as its left and right ends plus one middle column stretched to
+// the box's width. This turns the many primitive calls of themed box types,
+// or the call into Go of custom ones, into three image draws.
+
+namespace {
+
+// boxes taller than this are drawn directly, as their slices would be large
+// and rarely reused; past MAX_ENTRIES the least recently drawn are dropped
+enum { MAX_CACHED_HEIGHT = 96, MAX_ENTRIES = 1024 };
+
+struct Slices {
+  Fl_RGB_Image *left = NULL;
+  Fl_RGB_Image *middle = NULL;
+  Fl_RGB_Image *right = NULL;
+  int end_width = 0;
+  // the position of the key in g_recent
+  std::list<uint64_t>::iterator recent;
+
+  void release() {
+    delete left;
+    delete middle;
+    delete right;
+  }
+};
+
+bool g_enabled[FL_MAX_BOXTYPE + 1];
+Fl_Box_Draw_F *g_inner[FL_MAX_BOXTYPE + 1];
+std::unordered_map<uint64_t, Slices> g_slices;
+// the keys of g_slices, the most recently drawn first
+std::list<uint64_t> g_recent;
+float g_scale = 0;
+
+void clear_slices() {
+  for (auto &entry : g_slices) {
+    entry.second.release();
+  }
+  g_slices.clear();
+  g_recent.clear();
+}
+
+void evict_least_recent() {
+  auto it = g_slices.find(g_recent.back());
+  it->second.release();
+  g_slices.erase(it);
+  g_recent.pop_back();
+}
+
+// ovals are drawn as ellipses, whose middle is not a column repeated over
+// the width of the box
+bool is_oval(int id) {
+  return id == FL_OVAL_BOX || id == FL_OSHADOW_BOX || id == FL_OVAL_FRAME || id == FL_OFLAT_BOX;
+}
+
+// the width of the box ends kept unstretched; it covers the rounded ends of
+// the round and oval box types, whose radius is half the height
+int end_width(int h) {
+  return h / 2 + 4;
+}
+
+// renders the box over a black and a white background and recovers the
+// alpha channel from the difference, so that antialiased and transparent
+// parts of the box blend with whatever is behind it
+std::vector<uchar> render_rgba(Fl_Box_Draw_F *draw, int w, int h, Fl_Color c, int &dw, int &dh) {
+  std::vector<uchar> rgba;
+  Fl_RGB_Image *images[2] = {NULL, NULL};
+  for (int pass = 0; pass < 2; pass++) {
+    Fl_Image_Surface surface(w, h, 1);
+    Fl_Surface_Device::push_current(&surface);
+    fl_rectf(0, 0, w, h, pass ? FL_WHITE : FL_BLACK);
+    draw(0, 0, w, h, c);
+    images[pass] = surface.image();
+    Fl_Surface_Device::pop_current();
+  }
+  Fl_RGB_Image *b = images[0], *wh = images[1];
+  dw = b->data_w();
+  dh = b->data_h();
+  const int d = b->d();
+  if (d >= 3 && wh->data_w() == dw && wh->data_h() == dh && wh->d() == d) {
+    const uchar *black = (const uchar *)b->data()[0];
+    const uchar *white = (const uchar *)wh->data()[0];
+    const int bld = b->ld() ? b->ld() : dw * d;
+    const int wld = wh->ld() ? wh->ld() : dw * d;
+    rgba.resize((size_t)dw * dh * 4);
+    uchar *out = rgba.data();
+    for (int y = 0; y < dh; y++) {
+      const uchar *bp = black + y * bld;
+      const uchar *wp = white + y * wld;
+      for (int x = 0; x < dw; x++, bp += d, wp += d, out += 4) {
+        int diff = ((wp[0] - bp[0]) + (wp[1] - bp[1]) + (wp[2] - bp[2])) / 3;
+        int a = 255 - (diff < 0 ? 0 : diff > 255 ? 255 : diff);
+        for (int k = 0; k < 3; k++) {
+          int v = a ? bp[k] * 255 / a : 0;
+          out[k] = (uchar)(v > 255 ? 255 : v);
+        }
+        out[3] = (uchar)a;
+      }
+    }
+  }
+  delete images[0];
+  delete images[1];
+  return rgba;
+}
+
+Fl_RGB_Image *crop(const std::vector<uchar> &rgba, int dw, int dh, int x0, int cw, int w, int h) {
+  uchar *bits = new uchar[(size_t)cw * dh * 4];
+  for (int y = 0; y < dh; y++) {
+    memcpy(bits + (size_t)y * cw * 4, rgba.data() + ((size_t)y * dw + x0) * 4, (size_t)cw * 4);
+  }
+  Fl_RGB_Image *img = new Fl_RGB_Image(bits, cw, dh, 4);
+  img->alloc_array = 1;
+  // drawn at its size in FLTK units even when rendered at a higher resolution
+  img->scale(w, h, 0, 1);
+  return img;
+}
+
+bool make_slices(int id, int h, Fl_Color c, Slices &slices) {
+  const int end = end_width(h);
+  const int w = 2 * end + 1;
+  int dw, dh;
+  std::vector<uchar> rgba = render_rgba(g_inner[id], w, h, c, dw, dh);
+  if (rgba.empty()) {
+    return false;
+  }
+  const int dend = (int)(end * (double)dw / w + 0.5);
+  if (2 * dend >= dw) {
+    return false;
+  }
+  slices.end_width = end;
+  slices.left = crop(rgba, dw, dh, 0, dend, end, h);
+  slices.middle = crop(rgba, dw, dh, dend, 1, 1, h);
+  slices.right = crop(rgba, dw, dh, dw - dend, dend, end, h);
+  return true;
+}
+
+void draw_cached(int id, int x, int y, int w, int h, Fl_Color c) {
+  Fl_Box_Draw_F *inner = g_inner[id];
+  if (h <= 0 || h > MAX_CACHED_HEIGHT || w < 2 * end_width(h) + 1 || !inner) {
+    if (inner) {
+      inner(x, y, w, h, c);
+    }
+    return;
+  }
+  const float scale = fl_graphics_driver->scale();
+  if (scale != g_scale) {
+    clear_slices();
+    g_scale = scale;
+  }
+  const uint64_t key = (uint64_t)id | (uint64_t)(Fl::draw_box_active() ? 1 : 0) << 8 |
+                       (uint64_t)h << 9 | (uint64_t)c << 32;
+  auto it = g_slices.find(key);
+  if (it == g_slices.end()) {
+    Slices slices;
+    if (!make_slices(id, h, c, slices)) {
+      inner(x, y, w, h, c);
+      return;
+    }
+    if (g_slices.size() >= MAX_ENTRIES) {
+      evict_least_recent();
+    }
+    g_recent.push_front(key);
+    slices.recent = g_recent.begin();
+    it = g_slices.insert(std::make_pair(key, slices)).first;
+  } else {
+    g_recent.splice(g_recent.begin(), g_recent, it->second.recent);
+  }
+  Slices &s = it->second;
+  s.left->draw(x, y);
+  s.middle->scale(w - 2 * s.end_width, h, 0, 1);
+  s.middle->draw(x + s.end_width, y);
+  s.right->draw(x + w - s.end_width, y);
+}
+
+template<int N>
+void cached_trampoline(int x, int y, int w, int h, Fl_Color c) {
+  draw_cached(N, x, y, w, h, c);
+}
+
+template<int N>
+struct CachedTrampolines {
+  static void fill(Fl_Box_Draw_F **table) {
+    CachedTrampolines<N - 1>::fill(table);
+    table[N - 1] = &cached_trampoline<N - 1>;
+  }
+};
+
+template<>
+struct CachedTrampolines<0> {
+  static void fill(Fl_Box_Draw_F **) {}
+};
+
+Fl_Box_Draw_F **trampolines() {
+  static Fl_Box_Draw_F *table[FL_MAX_BOXTYPE + 1];
+  if (!table[0]) {
+    CachedTrampolines<FL_MAX_BOXTYPE + 1>::fill(table);
+  }
+  return table;
+}
+
+bool is_trampoline(Fl_Box_Draw_F *f) {
+  Fl_Box_Draw_F **table = trampolines();
+  for (int i = 0; i <= FL_MAX_BOXTYPE; i++) {
+    if (table[i] == f) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// routes the box type through the cache, keeping its current draw function
+// as the one rendering the slices. Box types copied from a cached one, as
+// schemes do, already use the cache.
+void install(int id) {
+  Fl_Box_Draw_F *current = Fl::get_boxtype((Fl_Boxtype)id);
+  if (!current || is_trampoline(current)) {
+    return;
+  }
+  g_inner[id] = current;
+  Fl_Boxtype b = (Fl_Boxtype)id;
+  Fl::set_boxtype(b, trampolines()[id], Fl::box_dx(b), Fl::box_dy(b), Fl::box_dw(b), Fl::box_dh(b));
+}
+
+}
+
+void go_fltk_box_cache_enable(int boxtype, int enabled) {
+  if (boxtype < 0 || boxtype > FL_MAX_BOXTYPE || !g_enabled[boxtype] == !enabled ||
+      (enabled && is_oval(boxtype))) {
+    return;
+  }
+  clear_slices();
+  g_enabled[boxtype] = enabled != 0;
+  Fl_Boxtype b = (Fl_Boxtype)boxtype;
+  if (enabled) {
+    install(boxtype);
+  } else if (Fl::get_boxtype(b) == trampolines()[boxtype] && g_inner[boxtype]) {
+    Fl::set_boxtype(b, g_inner[boxtype], Fl::box_dx(b), Fl::box_dy(b), Fl::box_dw(b), Fl::box_dh(b));
+  }
+}
+
+// drops all slices and re-routes box types whose draw function was replaced,
+// after a scheme, color or box type change
+void go_fltk_box_cache_refresh(void) {
+  clear_slices();
+  for (int i = 0; i <= FL_MAX_BOXTYPE; i++) {
+    if (g_enabled[i]) {
+      install(i);
+    }
+  }
+}
+
+int go_fltk_box_cache_size(void) {
+  return (int)g_slices.size();
+}
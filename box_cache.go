@@ -0,0 +1,58 @@
+package fltk_go
+
+/*
+#include "box_cache.h"
+*/
+import "C"
+
+// ThemedBoxTypes are the box types drawn with many primitives, which gain
+// the most from EnableBoxCache.
+var ThemedBoxTypes = []BoxType{
+	ROUND_UP_BOX, ROUND_DOWN_BOX, ROUNDED_BOX, RSHADOW_BOX, RFLAT_BOX,
+	PLASTIC_UP_BOX, PLASTIC_DOWN_BOX, PLASTIC_THIN_UP_BOX, PLASTIC_THIN_DOWN_BOX,
+	PLASTIC_ROUND_UP_BOX, PLASTIC_ROUND_DOWN_BOX,
+	GTK_UP_BOX, GTK_DOWN_BOX, GTK_THIN_UP_BOX, GTK_THIN_DOWN_BOX,
+	GLEAM_UP_BOX, GLEAM_DOWN_BOX, GLEAM_THIN_UP_BOX, GLEAM_THIN_DOWN_BOX,
+	GLEAM_ROUND_UP_BOX, GLEAM_ROUND_DOWN_BOX,
+}
+
+// EnableBoxCache draws the box types from cached slices: each combination of
+// box type, color and height is rendered once, then drawn as its two ends
+// and a stretched middle. Boxes taller than 96 pixels are drawn directly.
+// Without arguments it enables the cache for ThemedBoxTypes. It works for
+// custom box types as well, which then call into Go only when rendering
+// new slices.
+//
+// Box types whose drawing depends on more than their color and size, such
+// as ones showing the time, must not be cached. The oval box types, which
+// are drawn as ellipses rather than a middle stretched between two ends,
+// are never cached. The cache is cleared when
+// the scheme, a color or a box type changes.
+func EnableBoxCache(types ...BoxType) {
+	if len(types) == 0 {
+		types = ThemedBoxTypes
+	}
+	for _, b := range types {
+		C.go_fltk_box_cache_enable(C.int(b), 1)
+	}
+}
+
+func DisableBoxCache(types ...BoxType) {
+	if len(types) == 0 {
+		types = ThemedBoxTypes
+	}
+	for _, b := range types {
+		C.go_fltk_box_cache_enable(C.int(b), 0)
+	}
+}
+
+// ClearBoxCache drops all cached slices, for instance after changing what a
+// custom box type draws without calling SetBoxType again.
+func ClearBoxCache() {
+	C.go_fltk_box_cache_refresh()
+}
+
+// BoxCacheSize returns the number of cached box renderings.
+func BoxCacheSize() int {
+	return int(C.go_fltk_box_cache_size())
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  extern void go_fltk_box_cache_enable(int boxtype, int enabled);
+  extern void go_fltk_box_cache_refresh(void);
+  extern int go_fltk_box_cache_size(void);
+
+#ifdef __cplusplus
+}
+#endif
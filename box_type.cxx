@@ -0,0 +1,129 @@
+#include "box_type.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <FL/Fl.H>
+#include <FL/fl_draw.H>
+
+#include "box_cache.h"
+#include "_cgo_export.h"
+
+enum {
+  GRADIENT_NONE,
+  GRADIENT_VERTICAL,
+  GRADIENT_HORIZONTAL,
+};
+
+const int go_BOX_GRADIENT_NONE = GRADIENT_NONE;
+const int go_BOX_GRADIENT_VERTICAL = GRADIENT_VERTICAL;
+const int go_BOX_GRADIENT_HORIZONTAL = GRADIENT_HORIZONTAL;
+
+namespace {
+
+// Styles of the box types that are drawn without calling into Go.
+bool g_styled[FL_MAX_BOXTYPE + 1];
+GBoxStyle g_styles[FL_MAX_BOXTYPE + 1];
+
+// how far the row or column i of a box of the given length is indented by
+// corners of the given radius
+int corner_inset(int i, int length, int radius) {
+  const int d = i < radius ? i : length - 1 - i;
+  if (d >= radius) {
+    return 0;
+  }
+  const double dy = radius - d - 0.5;
+  return (int)std::lround(radius - std::sqrt((double)radius * radius - dy * dy));
+}
+
+void draw_styled_box(const GBoxStyle &style, int x, int y, int w, int h, Fl_Color c) {
+  Fl_Color from = c;
+  Fl_Color to = style.gradient_color;
+  Fl_Color border = style.border_color;
+  if (!Fl::draw_box_active()) {
+    from = fl_inactive(from);
+    to = fl_inactive(to);
+    border = fl_inactive(border);
+  }
+  const int r = std::min(style.radius, std::min(w, h) / 2);
+  if (style.fill) {
+    if (style.gradient == GRADIENT_HORIZONTAL) {
+      for (int i = 0; i < w; i++) {
+        fl_color(fl_color_average(to, from, w > 1 ? (float)i / (w - 1) : 0));
+        const int inset = corner_inset(i, w, r);
+        fl_yxline(x + i, y + inset, y + h - 1 - inset);
+      }
+    } else if (style.gradient == GRADIENT_VERTICAL || r > 0) {
+      fl_color(from);
+      for (int i = 0; i < h; i++) {
+        if (style.gradient == GRADIENT_VERTICAL) {
+          fl_color(fl_color_average(to, from, h > 1 ? (float)i / (h - 1) : 0));
+        }
+        const int inset = corner_inset(i, h, r);
+        fl_xyline(x + inset, y + i, x + w - 1 - inset);
+      }
+    } else {
+      fl_rectf(x, y, w, h, from);
+    }
+  }
+  fl_color(border);
+  for (int k = 0; k < style.border_width && 2 * k < std::min(w, h); k++) {
+    if (r > k) {
+      fl_rounded_rect(x + k, y + k, w - 2 * k, h - 2 * k, r - k);
+    } else {
+      fl_rect(x + k, y + k, w - 2 * k, h - 2 * k);
+    }
+  }
+}
+
+void draw_box(int id, int x, int y, int w, int h, Fl_Color c) {
+  if (g_styled[id]) {
+    draw_styled_box(g_styles[id], x, y, w, h, c);
+  } else {
+    _go_drawBox(id, x, y, w, h, c);
+  }
+}
+
+// FLTK does not pass the box type to its draw function, so each box type
+// gets an instance of this trampoline bound to its index.
+template<int N>
+void box_trampoline(int x, int y, int w, int h, Fl_Color c) {
+  draw_box(N, x, y, w, h, c);
+}
+
+template<int N>
+struct Trampolines {
+  static void fill(Fl_Box_Draw_F **table) {
+    Trampolines<N - 1>::fill(table);
+    table[N - 1] = &box_trampoline<N - 1>;
+  }
+};
+
+template<>
+struct Trampolines<0> {
+  static void fill(Fl_Box_Draw_F **) {}
+};
+
+Fl_Box_Draw_F *trampoline(int i) {
+  static Fl_Box_Draw_F *table[FL_MAX_BOXTYPE + 1];
+  if (!table[0]) {
+    Trampolines<FL_MAX_BOXTYPE + 1>::fill(table);
+  }
+  return table[i];
+}
+
+}
+
+void go_fltk_set_boxtype(int i, int dx, int dy, int dw, int dh) {
+  g_styled[i] = false;
+  Fl::set_boxtype((Fl_Boxtype)i, trampoline(i), dx, dy, dw, dh);
+  go_fltk_box_cache_refresh();
+}
+
+void go_fltk_set_boxtype_style(int i, const GBoxStyle *style) {
+  g_styles[i] = *style;
+  g_styled[i] = true;
+  const int bw = style->border_width;
+  Fl::set_boxtype((Fl_Boxtype)i, trampoline(i), bw, bw, 2 * bw, 2 * bw);
+  go_fltk_box_cache_refresh();
+}
@@ -0,0 +1,117 @@
+package fltk_go
+
+/*
+#include "box_type.h"
+*/
+import "C"
+import "sync"
+
+type BoxGradient int
+
+var (
+	BOX_GRADIENT_NONE       = BoxGradient(C.go_BOX_GRADIENT_NONE)
+	BOX_GRADIENT_VERTICAL   = BoxGradient(C.go_BOX_GRADIENT_VERTICAL)
+	BOX_GRADIENT_HORIZONTAL = BoxGradient(C.go_BOX_GRADIENT_HORIZONTAL)
+)
+
+// BoxStyle describes a box type drawn entirely in C++, without calling into
+// Go for every box.
+type BoxStyle struct {
+	// Fill fills the box with the widget's color, or with a gradient from
+	// it to GradientColor.
+	Fill          bool
+	Gradient      BoxGradient
+	GradientColor Color
+	// Radius rounds the corners of the fill and the border.
+	Radius      int
+	BorderWidth int
+	BorderColor Color
+}
+
+// maxBoxType is FLTK's FL_MAX_BOXTYPE; widgets keep their box type in a byte.
+const maxBoxType = 255
+
+var boxTypes = struct {
+	sync.Mutex
+	draw [maxBoxType + 1]func(x, y, w, h int, c Color)
+	used [maxBoxType + 1]bool
+	next BoxType
+}{next: FREE_BOXTYPE}
+
+func checkBoxType(b BoxType) {
+	if b < 0 || int(b) > maxBoxType {
+		panic("invalid box type")
+	}
+}
+
+// SetBoxType replaces how the box type is drawn. The optional offsets are the
+// dx, dy, dw and dh of the box's interior.
+func SetBoxType(b BoxType, d func(int, int, int, int, Color), o ...int) {
+	checkBoxType(b)
+	if len(o) < 4 {
+		o = append(o, []int{0, 0, 0, 0}...)
+	}
+	boxTypes.Lock()
+	boxTypes.draw[b] = d
+	boxTypes.used[b] = true
+	boxTypes.Unlock()
+	C.go_fltk_set_boxtype(C.int(b), C.int(o[0]), C.int(o[1]), C.int(o[2]), C.int(o[3]))
+}
+
+// SetBoxStyle makes the box type drawn from the style, in C++.
+func SetBoxStyle(b BoxType, style BoxStyle) {
+	checkBoxType(b)
+	boxTypes.Lock()
+	boxTypes.draw[b] = nil
+	boxTypes.used[b] = true
+	boxTypes.Unlock()
+	cstyle := C.GBoxStyle{
+		gradient:       C.int(style.Gradient),
+		gradient_color: C.uint(style.GradientColor),
+		radius:         C.int(style.Radius),
+		border_width:   C.int(style.BorderWidth),
+		border_color:   C.uint(style.BorderColor),
+	}
+	if style.Fill {
+		cstyle.fill = 1
+	}
+	C.go_fltk_set_boxtype_style(C.int(b), &cstyle)
+}
+
+func allocBoxType() BoxType {
+	boxTypes.Lock()
+	defer boxTypes.Unlock()
+	for b := boxTypes.next; int(b) <= maxBoxType; b++ {
+		if !boxTypes.used[b] {
+			boxTypes.used[b] = true
+			boxTypes.next = b + 1
+			return b
+		}
+	}
+	panic("no free box types left")
+}
+
+// NewBoxType allocates a new box type drawn by d. FLTK stores box types in a
+// byte, so up to 200 new box types are available.
+func NewBoxType(d func(int, int, int, int, Color), o ...int) BoxType {
+	b := allocBoxType()
+	SetBoxType(b, d, o...)
+	return b
+}
+
+// NewStyledBoxType allocates a new box type drawn from the style.
+func NewStyledBoxType(style BoxStyle) BoxType {
+	b := allocBoxType()
+	SetBoxStyle(b, style)
+	return b
+}
+
+//export _go_drawBox
+func _go_drawBox(b C.int, x, y, w, h C.int, c C.uint) {
+	boxTypes.Lock()
+	d := boxTypes.draw[b]
+	boxTypes.Unlock()
+	if d != nil {
+		d(int(x), int(y), int(w), int(h), Color(c))
+	}
+}
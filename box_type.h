@@ -0,0 +1,25 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  typedef struct {
+    int fill;
+    int gradient;
+    unsigned int gradient_color;
+    int radius;
+    int border_width;
+    unsigned int border_color;
+  } GBoxStyle;
+
+  extern const int go_BOX_GRADIENT_NONE;
+  extern const int go_BOX_GRADIENT_VERTICAL;
+  extern const int go_BOX_GRADIENT_HORIZONTAL;
+
+  extern void go_fltk_set_boxtype(int i, int dx, int dy, int dw, int dh);
+  extern void go_fltk_set_boxtype_style(int i, const GBoxStyle *style);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,6 +7,7 @@
 #include <FL/Fl_Select_Browser.H>
 
 #include "event_handler.h"
+#include "typeahead.h"
 
 
 // Implemented:
@@ -32,10 +33,118 @@
 //  load()
 
 
-class GBrowser : public EventHandler<Fl_Browser> {
+class BrowserWithTypeAhead {
+public:
+  virtual void line_added(int line) = 0;
+  virtual void line_removing(int line) = 0;
+  virtual void lines_cleared() = 0;
+  virtual void lines_reformatted() = 0;
+  virtual int typeahead_find_line(const char *prefix) = 0;
+};
+
+// BrowserTypeAhead indexes the lines of a browser by the text of their first
+// column, without the leading formatting codes.
+template<class B>
+class BrowserTypeAhead : public TypeAhead<B>, public BrowserWithTypeAhead {
+public:
+  template<class... Arg>
+  BrowserTypeAhead(Arg... args)
+    : TypeAhead<B>(args...) {}
+
+  void line_added(int line) override {
+    if (this->typeahead_enabled()) {
+      void *item = this->find_line(line);
+      this->typeahead_added(item, key(this->item_text(item)));
+    }
+  }
+
+  void line_removing(int line) override {
+    void *item = this->find_line(line);
+    this->typeahead_removed(item);
+    if (item == m_jumped) {
+      m_jumped = NULL;
+    }
+  }
+
+  void lines_cleared() override {
+    this->typeahead_cleared();
+    m_jumped = NULL;
+  }
+
+  // the keys depend on the format and column characters
+  void lines_reformatted() override {
+    if (this->typeahead_enabled()) {
+      this->typeahead_cleared();
+      typeahead_reindex();
+    }
+  }
+
+  int typeahead_find_line(const char *prefix) override {
+    return this->lineno(this->typeahead_find(prefix));
+  }
+
+protected:
+  void typeahead_reindex() override {
+    for (void *item = this->item_first(); item; item = this->item_next(item)) {
+      this->typeahead_added(item, key(this->item_text(item)));
+    }
+  }
+
+  bool typeahead_shown(void *item) override {
+    // hidden lines have no height
+    return this->item_height(item) > 0;
+  }
+
+  void *typeahead_current() override {
+    void *selection = this->selection();
+    return selection ? selection : m_jumped;
+  }
+
+  void typeahead_jump(void *item) override {
+    m_jumped = item;
+    if (this->type() == FL_NORMAL_BROWSER) {
+      this->Fl_Browser_::display(item);
+    } else {
+      this->select_only(item, this->when());
+    }
+  }
+
+private:
+  std::string key(const char *text) const {
+    if (!text) {
+      return std::string();
+    }
+    const char format = this->format_char();
+    const char *p = text;
+    while (format && p[0] == format && p[1]) {
+      const char code = p[1];
+      if (code == format) {
+        // a doubled format character stands for itself
+        p++;
+        break;
+      }
+      p += 2;
+      if (code == '.') {
+        break;
+      }
+      if (strchr("BCFS", code)) {
+        while (isdigit((unsigned char)*p)) {
+          p++;
+        }
+      }
+    }
+    const char column = this->column_char();
+    const char *end = column ? strchr(p, column) : NULL;
+    return TypeAheadIndex::fold(p, end ? (size_t)(end - p) : strlen(p));
+  }
+
+  void *m_jumped = NULL;
+};
+
+class GBrowser : public EventHandler<BrowserTypeAhead<Fl_Browser>> {
 public:
   GBrowser(int x, int y, int w, int h, const char *label)
-    : EventHandler<Fl_Browser>(x, y, w, h, label) {}
+    : EventHandler<BrowserTypeAhead<Fl_Browser>>(x, y, w, h, label) {}
 };
 
 GBrowser *go_fltk_new_Browser(int x, int y, int w, int h, const char *text) {
@@ -44,6 +153,9 @@ GBrowser *go_fltk_new_Browser(int x, int y, int w, int h, const char *text) {
 
 void go_fltk_Browser_add(Fl_Browser* b, const char *str, uintptr_t id) {
 	b->add(str, (void *)id);
+	if (BrowserWithTypeAhead *t = dynamic_cast<BrowserWithTypeAhead*>(b)) {
+		t->line_added(b->size());
+	}
 }
 
 int go_fltk_Browser_topline(Fl_Browser* b) {
@@ -64,36 +176,39 @@ void go_fltk_Browser_set_topline(Fl_Browser* b, int i) {
 
 void go_fltk_Browser_clear(Fl_Browser *b) {
         b->clear();
+	if (BrowserWithTypeAhead *t = dynamic_cast<BrowserWithTypeAhead*>(b)) {
+		t->lines_cleared();
+	}
 }  
 
 uintptr_t go_fltk_Browser_data(Fl_Browser* b, int line) {
 	return (uintptr_t)b->data(line);
 }
 
-class GSelectBrowser : public EventHandler<Fl_Select_Browser> {
+class GSelectBrowser : public EventHandler<BrowserTypeAhead<Fl_Select_Browser>> {
 public:
   GSelectBrowser(int x, int y, int w, int h, const char *label)
-    : EventHandler<Fl_Select_Browser>(x, y, w, h, label) {}
+    : EventHandler<BrowserTypeAhead<Fl_Select_Browser>>(x, y, w, h, label) {}
 };
 
 GSelectBrowser *go_fltk_new_Select_Browser(int x, int y, int w, int h, const char *text) {
 	return new GSelectBrowser(x, y, w, h, text);
 }
 
-class GHoldBrowser : public EventHandler<Fl_Hold_Browser> {
+class GHoldBrowser : public EventHandler<BrowserTypeAhead<Fl_Hold_Browser>> {
 public:
   GHoldBrowser(int x, int y, int w, int h, const char *label)
-    : EventHandler<Fl_Hold_Browser>(x, y, w, h, label) {}
+    : EventHandler<BrowserTypeAhead<Fl_Hold_Browser>>(x, y, w, h, label) {}
 };
 
 GHoldBrowser *go_fltk_new_Hold_Browser(int x, int y, int w, int h, const char *text) {
 	return new GHoldBrowser(x, y, w, h, text);
 }
 
-class GMultiBrowser : public EventHandler<Fl_Multi_Browser> {
+class GMultiBrowser : public EventHandler<BrowserTypeAhead<Fl_Multi_Browser>> {
 public:
   GMultiBrowser(int x, int y, int w, int h, const char *label)
-    : EventHandler<Fl_Multi_Browser>(x, y, w, h, label) {}
+    : EventHandler<BrowserTypeAhead<Fl_Multi_Browser>>(x, y, w, h, label) {}
 };
 
 GMultiBrowser *go_fltk_new_Multi_Browser(int x, int y, int w, int h, const char *text) {
@@ -101,6 +216,9 @@ GMultiBrowser *go_fltk_new_Multi_Browser(int x, int y, int w, int h, const char
 }
 
 void go_fltk_Browser_remove(Fl_Browser* b, int i) {
+	if (BrowserWithTypeAhead *t = dynamic_cast<BrowserWithTypeAhead*>(b)) {
+		t->line_removing(i);
+	}
 	b->remove(i);
 }
 
@@ -110,6 +228,9 @@ char go_fltk_Browser_column_char(Fl_Browser* b) {
 
 void go_fltk_Browser_set_column_char(Fl_Browser* b, char c) {
 	b->column_char(c);
+	if (BrowserWithTypeAhead *t = dynamic_cast<BrowserWithTypeAhead*>(b)) {
+		t->lines_reformatted();
+	}
 }
 
 void go_fltk_Browser_hide_line(Fl_Browser* b, int line) {
@@ -134,6 +255,9 @@ char go_fltk_Browser_format_char(Fl_Browser* b) {
 
 void go_fltk_Browser_set_format_char(Fl_Browser* b, char c) {
 	b->format_char(c);
+	if (BrowserWithTypeAhead *t = dynamic_cast<BrowserWithTypeAhead*>(b)) {
+		t->lines_reformatted();
+	}
 }
 
 int go_fltk_Browser_displayed(Fl_Browser* b, int line) {
@@ -164,6 +288,19 @@ int go_fltk_Browser_selected(Fl_Browser* b, int line) {
 	return b->selected(line);
 }
 
+void go_fltk_Browser_set_typeahead(Fl_Browser* b, int enabled) {
+	if (WidgetWithTypeAhead *t = dynamic_cast<WidgetWithTypeAhead*>(b)) {
+		t->set_typeahead(enabled != 0);
+	}
+}
+
+int go_fltk_Browser_find_prefix(Fl_Browser* b, const char *prefix) {
+	if (BrowserWithTypeAhead *t = dynamic_cast<BrowserWithTypeAhead*>(b)) {
+		return t->typeahead_find_line(prefix);
+	}
+	return 0;
+}
+
 class GCheckBrowser : public EventHandler<Fl_Check_Browser> {
 public:
   GCheckBrowser(int x, int y, int w, int h, const char *label)
@@ -225,6 +225,26 @@ func (b *Browser) IsSelected(line int) bool {
 	return C.go_fltk_Browser_selected((*C.Fl_Browser)(b.ptr()), C.int(line)) != 0
 }
 
+// SetTypeAhead enables jumping to the first line starting with the
+// characters typed while the browser has the focus. Lines are matched by the
+// text of their first column, ignoring ASCII case and formatting codes,
+// through an index kept up to date as lines are added and removed.
+func (b *Browser) SetTypeAhead(enabled bool) {
+	if enabled {
+		C.go_fltk_Browser_set_typeahead((*C.Fl_Browser)(b.ptr()), 1)
+	} else {
+		C.go_fltk_Browser_set_typeahead((*C.Fl_Browser)(b.ptr()), 0)
+	}
+}
+
+// FindPrefix returns the first line, in alphabetical order, that starts with
+// prefix and is not hidden, or 0 if there is none. It requires SetTypeAhead.
+func (b *Browser) FindPrefix(prefix string) int {
+	cPrefix := C.CString(prefix)
+	defer C.free(unsafe.Pointer(cPrefix))
+	return int(C.go_fltk_Browser_find_prefix((*C.Fl_Browser)(b.ptr()), cPrefix))
+}
+
 type SelectBrowser struct {
 	Browser
 }
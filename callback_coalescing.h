@@ -0,0 +1,109 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <FL/Fl.H>
+
+#include "callbacks.h"
+
+#include "_cgo_export.h"
+
+
+class WidgetWithCallbackCoalescing {
+public:
+  virtual void set_callback_coalescing(int enabled) = 0;
+  virtual int callback_coalescing() const = 0;
+  virtual void queue_callback(uintptr_t callbackId) = 0;
+};
+
+// CallbackCoalescing delays the widget's callback to the end of the current
+// frame, so that dragging a valuator invokes the Go callback at most once per
+// frame, with whatever value the widget has by then.  Releasing the mouse
+// button flushes a pending callback immediately, so the final value is always
+// delivered.  In a group such as Fl_Spinner the release goes to the child
+// that was pushed, so the end of the push is watched for instead.
+template<class BaseWidget>
+class CallbackCoalescing : public BaseWidget, public WidgetWithCallbackCoalescing {
+public:
+  template<class... Arg>
+  CallbackCoalescing(Arg... args)
+    : BaseWidget(args...) {}
+
+  virtual ~CallbackCoalescing() {
+    if (m_pending) {
+      Fl::remove_timeout(frame_cb, this);
+    }
+    Fl::remove_check(release_cb, this);
+  }
+
+  int handle(int event) override {
+    const int ret = BaseWidget::handle(event);
+    if (event == FL_RELEASE) {
+      flush_callback();
+    }
+    Fl_Widget *pushed = Fl::pushed();
+    if (event == FL_PUSH && pushed && pushed != this && this->contains(pushed)) {
+      Fl::remove_check(release_cb, this);
+      Fl::add_check(release_cb, this);
+    }
+    return ret;
+  }
+
+  void set_callback_coalescing(int enabled) final {
+    if (!enabled) {
+      flush_callback();
+    }
+    m_enabled = enabled != 0;
+    // keep the Go callback id, only swap the function dispatching it
+    if (this->callback() == callback_handler || this->callback() == coalescing_callback_handler) {
+      this->callback(m_enabled ? coalescing_callback_handler : callback_handler, this->user_data());
+    }
+  }
+
+  int callback_coalescing() const final {
+    return m_enabled;
+  }
+
+  void queue_callback(uintptr_t callbackId) final {
+    m_callbackId = callbackId;
+    if (!m_pending) {
+      m_pending = true;
+      Fl::add_timeout(FRAME_TIME, frame_cb, this);
+    }
+    if (Fl::event() == FL_RELEASE) {
+      flush_callback();
+    }
+  }
+
+private:
+  static constexpr double FRAME_TIME = 1.0 / 60.0;
+
+  // runs after each pass of the event loop until the child is released
+  static void release_cb(void *data) {
+    CallbackCoalescing *w = static_cast<CallbackCoalescing*>(data);
+    if (w->contains(Fl::pushed())) {
+      return;
+    }
+    Fl::remove_check(release_cb, w);
+    w->flush_callback();
+  }
+
+  static void frame_cb(void *data) {
+    CallbackCoalescing *w = static_cast<CallbackCoalescing*>(data);
+    w->m_pending = false;
+    _go_callbackHandler(w->m_callbackId);
+  }
+
+  void flush_callback() {
+    if (!m_pending) {
+      return;
+    }
+    Fl::remove_timeout(frame_cb, this);
+    m_pending = false;
+    _go_callbackHandler(m_callbackId);
+  }
+
+  bool m_enabled = false;
+  bool m_pending = false;
+  uintptr_t m_callbackId = 0;
+};
@@ -2,9 +2,22 @@
 
 #include <cstdint>
 
+#include <FL/Fl_Widget.H>
+
+#include "callback_coalescing.h"
+
 #include "_cgo_export.h"
 
 
 void callback_handler(Fl_Widget *w, void* data) {
   _go_callbackHandler((uintptr_t)data);
 }
+
+void coalescing_callback_handler(Fl_Widget *w, void* data) {
+  WidgetWithCallbackCoalescing* wc = dynamic_cast<WidgetWithCallbackCoalescing*>(w);
+  if (wc == nullptr) {
+    _go_callbackHandler((uintptr_t)data);
+    return;
+  }
+  wc->queue_callback((uintptr_t)data);
+}
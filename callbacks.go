@@ -98,6 +98,53 @@ func _go_eventHandler(handlerId C.int, event C.int) C.int {
 	return 0
 }
 
+// Delegated event handlers
+type delegatedEventHandlerMap struct {
+	delegatedEventHandlerMap map[int]func(Event, WidgetHandle) bool
+	id                       int
+}
+
+func newDelegatedEventHandlerMap() *delegatedEventHandlerMap {
+	return &delegatedEventHandlerMap{
+		delegatedEventHandlerMap: make(map[int]func(Event, WidgetHandle) bool),
+	}
+}
+func (m *delegatedEventHandlerMap) register(fn func(Event, WidgetHandle) bool) int {
+	m.id++
+	m.delegatedEventHandlerMap[m.id] = fn
+	return m.id
+}
+func (m *delegatedEventHandlerMap) unregister(id int) {
+	delete(m.delegatedEventHandlerMap, id)
+}
+func (m *delegatedEventHandlerMap) invoke(id int, event Event, target WidgetHandle) bool {
+	if handler, ok := m.delegatedEventHandlerMap[id]; ok && handler != nil {
+		return handler(event, target)
+	}
+	return false
+}
+func (m *delegatedEventHandlerMap) isEmpty() bool {
+	return len(m.delegatedEventHandlerMap) == 0
+}
+func (m *delegatedEventHandlerMap) size() int {
+	return len(m.delegatedEventHandlerMap)
+}
+func (m *delegatedEventHandlerMap) clear() {
+	for id := range m.delegatedEventHandlerMap {
+		delete(m.delegatedEventHandlerMap, id)
+	}
+}
+
+var globalDelegatedEventHandlerMap = newDelegatedEventHandlerMap()
+
+//export _go_delegatedEventHandler
+func _go_delegatedEventHandler(handlerId C.int, event C.int, target C.uint64_t) C.int {
+	if globalDelegatedEventHandlerMap.invoke(int(handlerId), Event(event), WidgetHandle(target)) {
+		return 1
+	}
+	return 0
+}
+
 // Draw handlers
 type drawHandlerMap struct {
 	drawHandlerMap map[uintptr]func(func())
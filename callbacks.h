@@ -7,6 +7,7 @@ extern "C" {
 typedef struct Fl_Widget Fl_Widget;
 
 extern void callback_handler(Fl_Widget *w, void* data);
+extern void coalescing_callback_handler(Fl_Widget *w, void* data);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,613 @@
+#include "canvas.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <FL/Fl.H>
+#include <FL/Fl_Image.H>
+#include <FL/Fl_Widget.H>
+#include <FL/fl_draw.H>
+#include <FL/platform.H>
+
+#include "event_handler.h"
+#include "rtree.h"
+
+
+enum CanvasShapeType {
+  SHAPE_RECT,
+  SHAPE_FILLED_RECT,
+  SHAPE_PATH,
+  SHAPE_POLYGON,
+  SHAPE_TEXT,
+  SHAPE_IMAGE,
+};
+
+// Shapes are kept small since a canvas may hold millions of them; paths,
+// texts and images keep their extra data in side tables indexed by data.
+struct CanvasShape {
+  RTreeBox box;  // world coordinates
+  Fl_Color color;
+  int data;
+  unsigned short lineWidth;
+  unsigned char type;
+  bool alive;
+  bool indexed;  // box is in the R-tree
+  bool pending;  // listed in m_pending
+};
+
+struct CanvasText {
+  std::string text;
+  Fl_Font font;
+  Fl_Fontsize size;
+};
+
+// Canvas is a retained mode drawing surface.  Shapes live in C++ and are
+// indexed by an R-tree, so drawing only visits the shapes intersecting the
+// damaged area and hit-testing does not need to look at every shape.  Shapes
+// are drawn in the order they were added.
+//
+// World coordinates map to the widget as x() + wx * zoom + panX.
+class Canvas : public Fl_Widget {
+public:
+  Canvas(int x, int y, int w, int h, const char *label)
+    : Fl_Widget(x, y, w, h, label) {
+    box(FL_FLAT_BOX);
+    color(FL_WHITE);
+  }
+
+  int add_rect(double x, double y, double w, double h, Fl_Color color, bool filled) {
+    CanvasShape s = new_shape(filled ? SHAPE_FILLED_RECT : SHAPE_RECT, color);
+    s.box = normalized(x, y, x + w, y + h);
+    return add(s);
+  }
+
+  int add_path(const double *points, int count, Fl_Color color, bool closed) {
+    if (count < 1) {
+      return 0;
+    }
+    CanvasShape s = new_shape(closed ? SHAPE_POLYGON : SHAPE_PATH, color);
+    std::vector<float> path(points, points + 2 * count);
+    s.box = {path[0], path[1], path[0], path[1]};
+    for (int i = 1; i < count; i++) {
+      s.box.extend({path[2 * i], path[2 * i + 1], path[2 * i], path[2 * i + 1]});
+    }
+    s.data = store(m_paths, m_freePaths, std::move(path));
+    return add(s);
+  }
+
+  int add_text(double x, double y, const char *text, Fl_Font font, Fl_Fontsize size, Fl_Color color) {
+    CanvasShape s = new_shape(SHAPE_TEXT, color);
+    fl_open_display();
+    fl_font(font, size);
+    int w = 0, h = 0;
+    fl_measure(text, w, h, 0);
+    s.box = {(float)x, (float)y, (float)(x + w), (float)(y + h)};
+    s.data = store(m_texts, m_freeTexts, CanvasText{text, font, size});
+    return add(s);
+  }
+
+  int add_image(double x, double y, Fl_Image *image) {
+    CanvasShape s = new_shape(SHAPE_IMAGE, FL_BLACK);
+    s.box = {(float)x, (float)y, (float)(x + image->w()), (float)(y + image->h())};
+    s.data = store(m_images, m_freeImages, image);
+    return add(s);
+  }
+
+  void remove(int id) {
+    CanvasShape *s = shape(id);
+    if (!s) {
+      return;
+    }
+    damage_shape(*s);
+    s->alive = false;
+    s->indexed = false;
+    m_alive--;
+    release_data(*s);
+  }
+
+  void clear() {
+    m_shapes.clear();
+    m_paths.clear();
+    m_texts.clear();
+    m_images.clear();
+    m_freePaths.clear();
+    m_freeTexts.clear();
+    m_freeImages.clear();
+    m_pending.clear();
+    m_tree.clear();
+    m_alive = 0;
+    m_maxLineWidth = 1;
+    redraw();
+  }
+
+  int shape_count() const {
+    return m_alive;
+  }
+
+  void move(int id, double dx, double dy) {
+    CanvasShape *s = shape(id);
+    if (!s) {
+      return;
+    }
+    damage_shape(*s);
+    s->box = {(float)(s->box.x0 + dx), (float)(s->box.y0 + dy), (float)(s->box.x1 + dx), (float)(s->box.y1 + dy)};
+    if (s->type == SHAPE_PATH || s->type == SHAPE_POLYGON) {
+      std::vector<float> &path = m_paths[s->data];
+      for (size_t i = 0; i + 1 < path.size(); i += 2) {
+        path[i] += (float)dx;
+        path[i + 1] += (float)dy;
+      }
+    }
+    reindex(id, *s);
+    damage_shape(*s);
+  }
+
+  void set_shape_color(int id, Fl_Color color) {
+    if (CanvasShape *s = shape(id)) {
+      s->color = color;
+      damage_shape(*s);
+    }
+  }
+
+  void set_shape_line_width(int id, int width) {
+    if (CanvasShape *s = shape(id)) {
+      damage_shape(*s);
+      s->lineWidth = (unsigned short)std::max(0, width);
+      m_maxLineWidth = std::max(m_maxLineWidth, (int)s->lineWidth);
+      damage_shape(*s);
+    }
+  }
+
+  bool shape_bounds(int id, double &x, double &y, double &w, double &h) {
+    CanvasShape *s = shape(id);
+    if (!s) {
+      return false;
+    }
+    x = s->box.x0, y = s->box.y0;
+    w = s->box.x1 - s->box.x0, h = s->box.y1 - s->box.y0;
+    return true;
+  }
+
+  // returns the topmost shape under the widget coordinates, or 0
+  int shape_at(int sx, int sy) {
+    const double tolerance = HIT_TOLERANCE / m_zoom;
+    const float wx = (float)to_world_x(sx), wy = (float)to_world_y(sy);
+    const float margin = (float)(tolerance + m_maxLineWidth / (2 * m_zoom));
+    int found = 0;
+    query({wx - margin, wy - margin, wx + margin, wy + margin}, [&](int id) {
+      if (id > found && hit(m_shapes[id - 1], wx, wy, tolerance)) {
+        found = id;
+      }
+    });
+    return found;
+  }
+
+  // collects the shapes intersecting the world rectangle in drawing order
+  void shapes_in(const RTreeBox &box, std::vector<int> &ids) {
+    ids.clear();
+    query(box, [&](int id) { ids.push_back(id); });
+    std::sort(ids.begin(), ids.end());
+  }
+
+  void set_view(double zoom, double panX, double panY) {
+    if (zoom <= 0) {
+      return;
+    }
+    m_zoom = zoom;
+    m_panX = panX;
+    m_panY = panY;
+    redraw();
+  }
+
+  void view(double &zoom, double &panX, double &panY) const {
+    zoom = m_zoom, panX = m_panX, panY = m_panY;
+  }
+
+  // zooms by factor keeping the world point under the widget coordinates still
+  void zoom_at(double factor, int sx, int sy) {
+    const double wx = to_world_x(sx), wy = to_world_y(sy);
+    double zoom = m_zoom * factor;
+    zoom = zoom < MIN_ZOOM ? MIN_ZOOM : (zoom > MAX_ZOOM ? MAX_ZOOM : zoom);
+    set_view(zoom, sx - x() - wx * zoom, sy - y() - wy * zoom);
+  }
+
+  void set_navigation(bool enabled) {
+    m_navigation = enabled;
+  }
+
+  int handle(int event) override {
+    if (!m_navigation) {
+      return Fl_Widget::handle(event);
+    }
+    switch (event) {
+    case FL_MOUSEWHEEL:
+      if (Fl::event_dy() == 0) {
+        break;
+      }
+      zoom_at(std::pow(WHEEL_ZOOM, -Fl::event_dy()), Fl::event_x(), Fl::event_y());
+      return 1;
+    case FL_PUSH:
+      if (Fl::event_button() != FL_MIDDLE_MOUSE && Fl::event_button() != FL_RIGHT_MOUSE) {
+        break;
+      }
+      m_panning = true;
+      m_dragX = Fl::event_x();
+      m_dragY = Fl::event_y();
+      return 1;
+    case FL_DRAG:
+      if (!m_panning) {
+        break;
+      }
+      set_view(m_zoom, m_panX + Fl::event_x() - m_dragX, m_panY + Fl::event_y() - m_dragY);
+      m_dragX = Fl::event_x();
+      m_dragY = Fl::event_y();
+      return 1;
+    case FL_RELEASE:
+      if (!m_panning) {
+        break;
+      }
+      m_panning = false;
+      return 1;
+    }
+    return Fl_Widget::handle(event);
+  }
+
+protected:
+  void draw() override {
+    draw_box();
+    // when only some shapes changed, FLTK clips drawing to their damaged area
+    int cx, cy, cw, ch;
+    fl_clip_box(x(), y(), w(), h(), cx, cy, cw, ch);
+    if (cw <= 0 || ch <= 0) {
+      return;
+    }
+    fl_push_clip(cx, cy, cw, ch);
+    const float margin = (float)((m_maxLineWidth + 1) / m_zoom);
+    const RTreeBox area = {(float)to_world_x(cx) - margin, (float)to_world_y(cy) - margin,
+                           (float)to_world_x(cx + cw) + margin, (float)to_world_y(cy + ch) + margin};
+    m_visible.clear();
+    query(area, [&](int id) { m_visible.push_back(id); });
+    if (m_visible.size() > m_shapes.size() / 4) {
+      // most shapes are visible, so walking them in order beats sorting
+      for (size_t i = 0; i < m_shapes.size(); i++) {
+        if (m_shapes[i].alive && m_shapes[i].box.intersects(area)) {
+          draw_shape(m_shapes[i]);
+        }
+      }
+    } else {
+      std::sort(m_visible.begin(), m_visible.end());
+      for (int id : m_visible) {
+        draw_shape(m_shapes[id - 1]);
+      }
+    }
+    fl_line_style(0);
+    fl_pop_clip();
+    draw_label();
+  }
+
+private:
+  static constexpr double HIT_TOLERANCE = 3;
+  static constexpr double WHEEL_ZOOM = 1.1;
+  static constexpr double MIN_ZOOM = 1e-4;
+  static constexpr double MAX_ZOOM = 1e4;
+
+  static RTreeBox normalized(double x0, double y0, double x1, double y1) {
+    return {(float)std::min(x0, x1), (float)std::min(y0, y1), (float)std::max(x0, x1), (float)std::max(y0, y1)};
+  }
+
+  static CanvasShape new_shape(CanvasShapeType type, Fl_Color color) {
+    CanvasShape s;
+    s.color = color;
+    s.data = -1;
+    s.lineWidth = 1;
+    s.type = (unsigned char)type;
+    s.alive = true;
+    s.indexed = false;
+    s.pending = false;
+    return s;
+  }
+
+  // puts value in a slot left by a removed shape, or at the end of table
+  template <typename T>
+  static int store(std::vector<T> &table, std::vector<int> &free, T value) {
+    if (free.empty()) {
+      table.push_back(std::move(value));
+      return (int)table.size() - 1;
+    }
+    const int slot = free.back();
+    free.pop_back();
+    table[slot] = std::move(value);
+    return slot;
+  }
+
+  // frees the side table data of a removed shape and lets its slot be reused
+  void release_data(CanvasShape &s) {
+    switch (s.type) {
+    case SHAPE_PATH:
+    case SHAPE_POLYGON:
+      std::vector<float>().swap(m_paths[s.data]);
+      m_freePaths.push_back(s.data);
+      break;
+    case SHAPE_TEXT:
+      m_texts[s.data] = CanvasText();
+      m_freeTexts.push_back(s.data);
+      break;
+    case SHAPE_IMAGE:
+      m_images[s.data] = nullptr;
+      m_freeImages.push_back(s.data);
+      break;
+    }
+    s.data = -1;
+  }
+
+  CanvasShape *shape(int id) {
+    if (id < 1 || id > (int)m_shapes.size() || !m_shapes[id - 1].alive) {
+      return nullptr;
+    }
+    return &m_shapes[id - 1];
+  }
+
+  int add(const CanvasShape &s) {
+    m_shapes.push_back(s);
+    m_alive++;
+    const int id = (int)m_shapes.size();
+    reindex(id, m_shapes.back());
+    damage_shape(m_shapes.back());
+    return id;
+  }
+
+  // Modified shapes are not inserted into the tree one by one; they are
+  // scanned linearly until there are enough of them to rebuild the tree.
+  void reindex(int id, CanvasShape &s) {
+    s.indexed = false;
+    if (!s.pending) {
+      s.pending = true;
+      m_pending.push_back(id);
+    }
+  }
+
+  template<class F>
+  void query(const RTreeBox &box, F f) {
+    if (m_pending.size() > REBUILD_MIN + (size_t)m_alive / 16) {
+      rebuild();
+    }
+    m_tree.query(box, [&](int id) {
+      if (m_shapes[id - 1].indexed) {
+        f(id);
+      }
+    });
+    for (int id : m_pending) {
+      const CanvasShape &s = m_shapes[id - 1];
+      if (s.alive && s.box.intersects(box)) {
+        f(id);
+      }
+    }
+  }
+
+  void rebuild() {
+    std::vector<RTree::Entry> entries;
+    entries.reserve(m_alive);
+    for (size_t i = 0; i < m_shapes.size(); i++) {
+      CanvasShape &s = m_shapes[i];
+      s.pending = false;
+      s.indexed = s.alive;
+      if (s.alive) {
+        entries.push_back({s.box, (int)i + 1});
+      }
+    }
+    m_tree.build(std::move(entries));
+    m_pending.clear();
+  }
+
+  double to_world_x(int sx) const { return (sx - x() - m_panX) / m_zoom; }
+  double to_world_y(int sy) const { return (sy - y() - m_panY) / m_zoom; }
+  int to_screen_x(double wx) const { return (int)std::floor(clamp_screen(x() + wx * m_zoom + m_panX)); }
+  int to_screen_y(double wy) const { return (int)std::floor(clamp_screen(y() + wy * m_zoom + m_panY)); }
+
+  // far away shapes at a high zoom would overflow int, and the differences
+  // of the clamped coordinates still fit
+  static double clamp_screen(double v) {
+    const double limit = INT_MAX / 2;
+    return std::max(-limit, std::min(limit, v));
+  }
+
+  void damage_shape(const CanvasShape &s) {
+    const int pad = s.lineWidth + 2;
+    int x0 = to_screen_x(s.box.x0) - pad, y0 = to_screen_y(s.box.y0) - pad;
+    int x1 = to_screen_x(s.box.x1) + pad, y1 = to_screen_y(s.box.y1) + pad;
+    x0 = std::max(x0, x()), y0 = std::max(y0, y());
+    x1 = std::min(x1, x() + w()), y1 = std::min(y1, y() + h());
+    if (x1 > x0 && y1 > y0) {
+      damage(FL_DAMAGE_USER1, x0, y0, x1 - x0, y1 - y0);
+    }
+  }
+
+  void draw_shape(const CanvasShape &s) {
+    const int x0 = to_screen_x(s.box.x0), y0 = to_screen_y(s.box.y0);
+    const int x1 = to_screen_x(s.box.x1), y1 = to_screen_y(s.box.y1);
+    fl_color(s.color);
+    if (x1 - x0 < 2 && y1 - y0 < 2 && s.type != SHAPE_TEXT) {
+      // too small to tell apart at this zoom level
+      fl_point(x0, y0);
+      return;
+    }
+    fl_line_style(FL_SOLID, s.lineWidth);
+    switch (s.type) {
+    case SHAPE_RECT:
+      fl_rect(x0, y0, std::max(1, x1 - x0), std::max(1, y1 - y0));
+      break;
+    case SHAPE_FILLED_RECT:
+      fl_rectf(x0, y0, std::max(1, x1 - x0), std::max(1, y1 - y0));
+      break;
+    case SHAPE_PATH:
+    case SHAPE_POLYGON: {
+      const std::vector<float> &path = m_paths[s.data];
+      if (s.type == SHAPE_POLYGON) {
+        fl_begin_complex_polygon();
+      } else {
+        fl_begin_line();
+      }
+      for (size_t i = 0; i + 1 < path.size(); i += 2) {
+        fl_vertex(clamp_screen(x() + path[i] * m_zoom + m_panX), clamp_screen(y() + path[i + 1] * m_zoom + m_panY));
+      }
+      if (s.type == SHAPE_POLYGON) {
+        fl_end_complex_polygon();
+      } else {
+        fl_end_line();
+      }
+      break;
+    }
+    case SHAPE_TEXT: {
+      const CanvasText &t = m_texts[s.data];
+      const int size = (int)std::lround(t.size * m_zoom);
+      if (size < 2) {
+        return;
+      }
+      fl_font(t.font, size);
+      fl_draw(t.text.c_str(), x0, y0 + fl_height() - fl_descent());
+      break;
+    }
+    case SHAPE_IMAGE: {
+      // the image may be shared, so its drawing size is put back
+      Fl_Image *image = m_images[s.data];
+      const int w = image->w(), h = image->h();
+      image->scale(x1 - x0, y1 - y0, 0, 1);
+      image->draw(x0, y0);
+      image->scale(w, h, 0, 1);
+      break;
+    }
+    }
+  }
+
+  static double segment_distance(float px, float py, float ax, float ay, float bx, float by) {
+    const double dx = bx - ax, dy = by - ay;
+    const double len = dx * dx + dy * dy;
+    double t = len > 0 ? ((px - ax) * dx + (py - ay) * dy) / len : 0;
+    t = std::max(0.0, std::min(1.0, t));
+    return std::hypot(px - (ax + t * dx), py - (ay + t * dy));
+  }
+
+  bool hit(const CanvasShape &s, float wx, float wy, double tolerance) const {
+    if (s.type != SHAPE_PATH && s.type != SHAPE_POLYGON) {
+      return wx >= s.box.x0 - tolerance && wx <= s.box.x1 + tolerance &&
+             wy >= s.box.y0 - tolerance && wy <= s.box.y1 + tolerance;
+    }
+    const std::vector<float> &path = m_paths[s.data];
+    const size_t n = path.size() / 2;
+    const double limit = tolerance + s.lineWidth / (2 * m_zoom);
+    bool inside = false;
+    for (size_t i = 0; i < n; i++) {
+      const size_t j = (i + n - 1) % n;
+      const float ax = path[2 * j], ay = path[2 * j + 1], bx = path[2 * i], by = path[2 * i + 1];
+      if ((i > 0 || s.type == SHAPE_POLYGON || n == 1) && segment_distance(wx, wy, ax, ay, bx, by) <= limit) {
+        return true;
+      }
+      if (s.type == SHAPE_POLYGON && (by > wy) != (ay > wy) && wx < (ax - bx) * (wy - by) / (ay - by) + bx) {
+        inside = !inside;
+      }
+    }
+    return inside;
+  }
+
+  static constexpr size_t REBUILD_MIN = 1024;
+
+  std::vector<CanvasShape> m_shapes;  // shape id - 1
+  std::vector<std::vector<float>> m_paths;
+  std::vector<CanvasText> m_texts;
+  std::vector<Fl_Image*> m_images;
+  // slots of the side tables left by removed shapes
+  std::vector<int> m_freePaths, m_freeTexts, m_freeImages;
+  std::vector<int> m_pending;
+  std::vector<int> m_visible;
+  RTree m_tree;
+  int m_alive = 0;
+  int m_maxLineWidth = 1;
+
+  double m_zoom = 1;
+  double m_panX = 0, m_panY = 0;
+  bool m_navigation = false;
+  bool m_panning = false;
+  int m_dragX = 0, m_dragY = 0;
+};
+
+class GCanvas : public EventHandler<Canvas> {
+public:
+  GCanvas(int x, int y, int w, int h, const char *label)
+    : EventHandler<Canvas>(x, y, w, h, label) {}
+};
+
+GCanvas *go_fltk_new_Canvas(int x, int y, int w, int h, const char *label) {
+  return new GCanvas(x, y, w, h, label);
+}
+
+int go_fltk_Canvas_add_rect(GCanvas *c, double x, double y, double w, double h, unsigned int color, int filled) {
+  return c->add_rect(x, y, w, h, color, filled != 0);
+}
+int go_fltk_Canvas_add_rects(GCanvas *c, const double *rects, int count, unsigned int color, int filled) {
+  int first = 0;
+  for (int i = 0; i < count; i++) {
+    const double *r = rects + 4 * i;
+    const int id = c->add_rect(r[0], r[1], r[2], r[3], color, filled != 0);
+    if (i == 0) {
+      first = id;
+    }
+  }
+  return first;
+}
+int go_fltk_Canvas_add_path(GCanvas *c, const double *points, int count, unsigned int color, int closed) {
+  return c->add_path(points, count, color, closed != 0);
+}
+int go_fltk_Canvas_add_text(GCanvas *c, double x, double y, const char *text, int font, int size, unsigned int color) {
+  return c->add_text(x, y, text, (Fl_Font)font, (Fl_Fontsize)size, color);
+}
+int go_fltk_Canvas_add_image(GCanvas *c, double x, double y, Fl_Image *image) {
+  return c->add_image(x, y, image);
+}
+void go_fltk_Canvas_remove(GCanvas *c, int id) {
+  c->remove(id);
+}
+void go_fltk_Canvas_clear(GCanvas *c) {
+  c->clear();
+}
+int go_fltk_Canvas_shape_count(GCanvas *c) {
+  return c->shape_count();
+}
+
+void go_fltk_Canvas_move(GCanvas *c, int id, double dx, double dy) {
+  c->move(id, dx, dy);
+}
+void go_fltk_Canvas_set_shape_color(GCanvas *c, int id, unsigned int color) {
+  c->set_shape_color(id, color);
+}
+void go_fltk_Canvas_set_shape_line_width(GCanvas *c, int id, int width) {
+  c->set_shape_line_width(id, width);
+}
+int go_fltk_Canvas_shape_bounds(GCanvas *c, int id, double *x, double *y, double *w, double *h) {
+  return c->shape_bounds(id, *x, *y, *w, *h);
+}
+
+int go_fltk_Canvas_shape_at(GCanvas *c, int x, int y) {
+  return c->shape_at(x, y);
+}
+int go_fltk_Canvas_shapes_in(GCanvas *c, double x, double y, double w, double h, int *ids, int capacity) {
+  std::vector<int> found;
+  c->shapes_in({(float)std::min(x, x + w), (float)std::min(y, y + h), (float)std::max(x, x + w), (float)std::max(y, y + h)}, found);
+  std::copy(found.begin(), found.begin() + std::min((int)found.size(), capacity), ids);
+  return (int)found.size();
+}
+
+void go_fltk_Canvas_set_view(GCanvas *c, double zoom, double panX, double panY) {
+  c->set_view(zoom, panX, panY);
+}
+void go_fltk_Canvas_view(GCanvas *c, double *zoom, double *panX, double *panY) {
+  c->view(*zoom, *panX, *panY);
+}
+void go_fltk_Canvas_zoom_at(GCanvas *c, double factor, int x, int y) {
+  c->zoom_at(factor, x, y);
+}
+void go_fltk_Canvas_set_navigation(GCanvas *c, int enabled) {
+  c->set_navigation(enabled != 0);
+}
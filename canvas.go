@@ -0,0 +1,171 @@
+package fltk_go
+
+/*
+#include <stdlib.h>
+#include "canvas.h"
+*/
+import "C"
+import "unsafe"
+
+// ShapeID identifies a shape of a Canvas. Zero is never a valid shape.
+type ShapeID int
+
+// Canvas is a retained mode drawing widget. Shapes are stored and drawn on
+// the C++ side and kept in a spatial index, so redraws only visit the shapes
+// in the damaged part of the view and hit-testing stays fast with millions of
+// shapes, without calling into Go for each of them.
+//
+// Shape coordinates are in world units. The view maps them to the widget as
+// x = X() + wx*zoom + panX, see SetView.
+type Canvas struct {
+	widget
+}
+
+func NewCanvas(x, y, w, h int, text ...string) *Canvas {
+	c := &Canvas{}
+	initWidget(c, unsafe.Pointer(C.go_fltk_new_Canvas(C.int(x), C.int(y), C.int(w), C.int(h), cStringOpt(text))))
+	return c
+}
+
+func (c *Canvas) canvas() *C.GCanvas {
+	return (*C.GCanvas)(c.ptr())
+}
+
+// AddRect adds a rectangle outline.
+func (c *Canvas) AddRect(x, y, w, h float64, color Color) ShapeID {
+	return ShapeID(C.go_fltk_Canvas_add_rect(c.canvas(), C.double(x), C.double(y), C.double(w), C.double(h), C.uint(color), 0))
+}
+
+// AddFilledRect adds a filled rectangle.
+func (c *Canvas) AddFilledRect(x, y, w, h float64, color Color) ShapeID {
+	return ShapeID(C.go_fltk_Canvas_add_rect(c.canvas(), C.double(x), C.double(y), C.double(w), C.double(h), C.uint(color), 1))
+}
+
+// AddFilledRects adds many filled rectangles of the same color in a single
+// call. rects holds x, y, w, h for each rectangle. The new shapes have
+// consecutive ids starting with the returned one.
+func (c *Canvas) AddFilledRects(rects []float64, color Color) ShapeID {
+	if len(rects) < 4 {
+		return 0
+	}
+	return ShapeID(C.go_fltk_Canvas_add_rects(c.canvas(), (*C.double)(unsafe.Pointer(&rects[0])), C.int(len(rects)/4), C.uint(color), 1))
+}
+
+// AddPath adds a polyline through the points, given as x0, y0, x1, y1, ...
+// A closed path is filled as a polygon.
+func (c *Canvas) AddPath(points []float64, color Color, closed bool) ShapeID {
+	if len(points) < 2 {
+		return 0
+	}
+	cclosed := 0
+	if closed {
+		cclosed = 1
+	}
+	return ShapeID(C.go_fltk_Canvas_add_path(c.canvas(), (*C.double)(unsafe.Pointer(&points[0])), C.int(len(points)/2), C.uint(color), C.int(cclosed)))
+}
+
+// AddText adds a text whose top left corner is at x, y.
+func (c *Canvas) AddText(x, y float64, text string, font Font, size int, color Color) ShapeID {
+	ctext := C.CString(text)
+	defer C.free(unsafe.Pointer(ctext))
+	return ShapeID(C.go_fltk_Canvas_add_text(c.canvas(), C.double(x), C.double(y), ctext, C.int(font), C.int(size), C.uint(color)))
+}
+
+// AddImage adds an image whose top left corner is at x, y. The image is not
+// copied and must not be destroyed while the shape is in use.
+func (c *Canvas) AddImage(x, y float64, img Image) ShapeID {
+	return ShapeID(C.go_fltk_Canvas_add_image(c.canvas(), C.double(x), C.double(y), img.getImage().ptr()))
+}
+
+// Remove deletes the shape. Ids of removed shapes are not reused until Clear.
+func (c *Canvas) Remove(id ShapeID) {
+	C.go_fltk_Canvas_remove(c.canvas(), C.int(id))
+}
+
+// Clear removes all shapes.
+func (c *Canvas) Clear() {
+	C.go_fltk_Canvas_clear(c.canvas())
+}
+
+func (c *Canvas) ShapeCount() int {
+	return int(C.go_fltk_Canvas_shape_count(c.canvas()))
+}
+
+// Move translates the shape by dx, dy world units, redrawing only the area
+// it covered before and after the move.
+func (c *Canvas) Move(id ShapeID, dx, dy float64) {
+	C.go_fltk_Canvas_move(c.canvas(), C.int(id), C.double(dx), C.double(dy))
+}
+
+func (c *Canvas) SetShapeColor(id ShapeID, color Color) {
+	C.go_fltk_Canvas_set_shape_color(c.canvas(), C.int(id), C.uint(color))
+}
+
+// SetShapeLineWidth sets the line width in pixels used for outlines and
+// paths. It does not scale with the zoom.
+func (c *Canvas) SetShapeLineWidth(id ShapeID, width int) {
+	C.go_fltk_Canvas_set_shape_line_width(c.canvas(), C.int(id), C.int(width))
+}
+
+// ShapeBounds returns the bounding box of the shape in world coordinates.
+func (c *Canvas) ShapeBounds(id ShapeID) (x, y, w, h float64, ok bool) {
+	var cx, cy, cw, ch C.double
+	ret := C.go_fltk_Canvas_shape_bounds(c.canvas(), C.int(id), &cx, &cy, &cw, &ch)
+	return float64(cx), float64(cy), float64(cw), float64(ch), ret != 0
+}
+
+// ShapeAt returns the topmost shape under the given widget coordinates, such
+// as EventX() and EventY(), or zero if there is none.
+func (c *Canvas) ShapeAt(x, y int) ShapeID {
+	return ShapeID(C.go_fltk_Canvas_shape_at(c.canvas(), C.int(x), C.int(y)))
+}
+
+// ShapesIn returns the shapes whose bounding box intersects the rectangle
+// given in world coordinates, in drawing order.
+func (c *Canvas) ShapesIn(x, y, w, h float64) []ShapeID {
+	ids := make([]C.int, 64)
+	for {
+		n := int(C.go_fltk_Canvas_shapes_in(c.canvas(), C.double(x), C.double(y), C.double(w), C.double(h), &ids[0], C.int(len(ids))))
+		if n <= len(ids) {
+			res := make([]ShapeID, n)
+			for i := range res {
+				res[i] = ShapeID(ids[i])
+			}
+			return res
+		}
+		ids = make([]C.int, n)
+	}
+}
+
+// SetView sets the zoom factor and the pan offset in pixels.
+func (c *Canvas) SetView(zoom, panX, panY float64) {
+	C.go_fltk_Canvas_set_view(c.canvas(), C.double(zoom), C.double(panX), C.double(panY))
+}
+
+func (c *Canvas) View() (zoom, panX, panY float64) {
+	var czoom, cpanX, cpanY C.double
+	C.go_fltk_Canvas_view(c.canvas(), &czoom, &cpanX, &cpanY)
+	return float64(czoom), float64(cpanX), float64(cpanY)
+}
+
+// ZoomAt multiplies the zoom by factor, keeping the point under the given
+// widget coordinates in place.
+func (c *Canvas) ZoomAt(factor float64, x, y int) {
+	C.go_fltk_Canvas_zoom_at(c.canvas(), C.double(factor), C.int(x), C.int(y))
+}
+
+// ScreenToWorld converts widget coordinates to world coordinates.
+func (c *Canvas) ScreenToWorld(x, y int) (float64, float64) {
+	zoom, panX, panY := c.View()
+	return (float64(x-c.X()) - panX) / zoom, (float64(y-c.Y()) - panY) / zoom
+}
+
+// SetNavigation enables zooming with the mouse wheel and panning by dragging
+// with the middle or right mouse button, handled entirely in C++.
+func (c *Canvas) SetNavigation(enabled bool) {
+	cenabled := 0
+	if enabled {
+		cenabled = 1
+	}
+	C.go_fltk_Canvas_set_navigation(c.canvas(), C.int(cenabled))
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  typedef struct GCanvas GCanvas;
+  typedef struct Fl_Image Fl_Image;
+
+  extern GCanvas *go_fltk_new_Canvas(int x, int y, int w, int h, const char *label);
+
+  extern int go_fltk_Canvas_add_rect(GCanvas *c, double x, double y, double w, double h, unsigned int color, int filled);
+  extern int go_fltk_Canvas_add_rects(GCanvas *c, const double *rects, int count, unsigned int color, int filled);
+  extern int go_fltk_Canvas_add_path(GCanvas *c, const double *points, int count, unsigned int color, int closed);
+  extern int go_fltk_Canvas_add_text(GCanvas *c, double x, double y, const char *text, int font, int size, unsigned int color);
+  extern int go_fltk_Canvas_add_image(GCanvas *c, double x, double y, Fl_Image *image);
+  extern void go_fltk_Canvas_remove(GCanvas *c, int id);
+  extern void go_fltk_Canvas_clear(GCanvas *c);
+  extern int go_fltk_Canvas_shape_count(GCanvas *c);
+
+  extern void go_fltk_Canvas_move(GCanvas *c, int id, double dx, double dy);
+  extern void go_fltk_Canvas_set_shape_color(GCanvas *c, int id, unsigned int color);
+  extern void go_fltk_Canvas_set_shape_line_width(GCanvas *c, int id, int width);
+  extern int go_fltk_Canvas_shape_bounds(GCanvas *c, int id, double *x, double *y, double *w, double *h);
+
+  extern int go_fltk_Canvas_shape_at(GCanvas *c, int x, int y);
+  extern int go_fltk_Canvas_shapes_in(GCanvas *c, double x, double y, double w, double h, int *ids, int capacity);
+
+  extern void go_fltk_Canvas_set_view(GCanvas *c, double zoom, double panX, double panY);
+  extern void go_fltk_Canvas_view(GCanvas *c, double *zoom, double *panX, double *panY);
+  extern void go_fltk_Canvas_zoom_at(GCanvas *c, double factor, int x, int y);
+  extern void go_fltk_Canvas_set_navigation(GCanvas *c, int enabled);
+
+#ifdef __cplusplus
+}
+#endif
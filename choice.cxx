@@ -3,11 +3,12 @@
 #include <FL/Fl_Choice.H>
 
 #include "event_handler.h"
+#include "shortcut_index.h"
 
-class GChoice : public EventHandler<Fl_Choice> {
+class GChoice : public EventHandler<ShortcutIndex<Fl_Choice>> {
 public:
   GChoice(int x, int y, int w, int h, const char *label)
-    : EventHandler<Fl_Choice>(x, y, w, h, label) {}
+    : EventHandler<ShortcutIndex<Fl_Choice>>(x, y, w, h, label) {}
 };
 
 GChoice *go_fltk_new_Choice(int x, int y, int w, int h, const char *label) {
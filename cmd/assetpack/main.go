@@ -0,0 +1,52 @@
+// Command assetpack packs the PNG images of a directory into an asset
+// bundle that can be opened with fltk_go.OpenAssetBundle.
+//
+//	assetpack -format qoi -o assets.bundle ./images
+package main
+
+import (
+	"flag"
+	"fmt"
+	"os"
+
+	"github.com/george012/fltk_go/assetbundle"
+)
+
+func main() {
+	format := flag.String("format", "raw", "entry format, raw or qoi")
+	out := flag.String("o", "assets.bundle", "output file")
+	flag.Parse()
+	if flag.NArg() != 1 {
+		fmt.Fprintln(os.Stderr, "usage: assetpack [-format raw|qoi] [-o file] dir")
+		os.Exit(2)
+	}
+	var f assetbundle.Format
+	switch *format {
+	case "raw":
+		f = assetbundle.Raw
+	case "qoi":
+		f = assetbundle.QOI
+	default:
+		fmt.Fprintf(os.Stderr, "unknown format %q\n", *format)
+		os.Exit(2)
+	}
+	w := assetbundle.NewWriter(f)
+	if err := w.AddDir(flag.Arg(0)); err != nil {
+		fmt.Fprintln(os.Stderr, err)
+		os.Exit(1)
+	}
+	file, err := os.Create(*out)
+	if err != nil {
+		fmt.Fprintln(os.Stderr, err)
+		os.Exit(1)
+	}
+	if _, err := w.WriteTo(file); err != nil {
+		file.Close()
+		fmt.Fprintln(os.Stderr, err)
+		os.Exit(1)
+	}
+	if err := file.Close(); err != nil {
+		fmt.Fprintln(os.Stderr, err)
+		os.Exit(1)
+	}
+}
@@ -0,0 +1,143 @@
+#include "diff_view.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <FL/Fl_Text_Buffer.H>
+#include <FL/Fl_Text_Display.H>
+
+#include "event_handler.h"
+
+
+// DiffDisplay shows one side of a diff and keeps the other side, its peer,
+// scrolled to the matching lines. The alignment maps each line of this side
+// to the line of the peer shown next to it; it is appended to as the diff is
+// computed and extrapolated line for line past its end.
+//
+// The display owns its text and style buffers. They are held in a base
+// class so that they outlive Fl_Text_Display, which detaches from its buffer
+// when it is destroyed.
+struct DiffBuffers {
+  Fl_Text_Buffer m_text;
+  Fl_Text_Buffer m_style;
+};
+
+class DiffDisplay : private DiffBuffers, public Fl_Text_Display {
+public:
+  DiffDisplay(int x, int y, int w, int h, const char *label)
+    : Fl_Text_Display(x, y, w, h, label) {
+    buffer(&m_text);
+  }
+
+  ~DiffDisplay() {
+    set_peer(NULL);
+  }
+
+  Fl_Text_Buffer *diff_style_buffer() {
+    return &m_style;
+  }
+
+  void set_peer(DiffDisplay *peer) {
+    if (m_peer) {
+      m_peer->m_peer = NULL;
+    }
+    m_peer = peer;
+    if (m_peer) {
+      m_peer->m_peer = this;
+    }
+  }
+
+  void clear_alignment() {
+    m_peerLines.clear();
+    m_peerEnd = 0;
+    m_syncedTop = m_syncedCol = -1;
+  }
+
+  // peerEnd is the line of the peer matching the line after the aligned
+  // ones, from which the lines after them are matched in order
+  void append_alignment(const int *peerLines, int count, int peerEnd) {
+    m_peerLines.insert(m_peerLines.end(), peerLines, peerLines + count);
+    m_peerEnd = peerEnd;
+  }
+
+  // scrolls to show the line, counted from 1, at the top
+  void scroll_to_line(int line) {
+    scroll(std::max(1, line), scroll_col());
+    sync();
+  }
+
+  int handle(int event) override {
+    const int ret = Fl_Text_Display::handle(event);
+    sync();
+    return ret;
+  }
+
+protected:
+  void draw() override {
+    // the scrollbars move the text from their callbacks, which redraw it
+    Fl_Text_Display::draw();
+    sync();
+  }
+
+private:
+  int peer_line(int line) const {
+    if (line < (int)m_peerLines.size()) {
+      return m_peerLines[line];
+    }
+    return m_peerEnd + line - (int)m_peerLines.size();
+  }
+
+  // scrolls the peer after this display scrolled; the synced positions
+  // keep the peer from scrolling this display back
+  void sync() {
+    const int top = scroll_row(), col = scroll_col();
+    if (!m_peer || (top == m_syncedTop && col == m_syncedCol)) {
+      return;
+    }
+    m_syncedTop = top;
+    m_syncedCol = col;
+    m_peer->scroll(peer_line(top - 1) + 1, col);
+    m_peer->m_syncedTop = m_peer->scroll_row();
+    m_peer->m_syncedCol = m_peer->scroll_col();
+  }
+
+  DiffDisplay *m_peer = NULL;
+  // the line of the peer matching each line, counted from 0
+  std::vector<int> m_peerLines;
+  int m_peerEnd = 0;
+  int m_syncedTop = -1;
+  int m_syncedCol = -1;
+};
+
+class GDiffDisplay : public EventHandler<DiffDisplay> {
+public:
+  GDiffDisplay(int x, int y, int w, int h, const char *label)
+    : EventHandler<DiffDisplay>(x, y, w, h, label) {}
+};
+
+// the buffers are the first base of a DiffDisplay, which puts its
+// Fl_Text_Display at a non-zero offset; it is passed around as that
+// Fl_Text_Display, which only a static_cast turns back into the display
+static GDiffDisplay *diff_display(Fl_Text_Display *d) {
+  return static_cast<GDiffDisplay *>(d);
+}
+
+Fl_Text_Display *go_fltk_new_DiffDisplay(int x, int y, int w, int h, const char *label) {
+  return new GDiffDisplay(x, y, w, h, label);
+}
+
+Fl_Text_Buffer *go_fltk_DiffDisplay_style_buffer(Fl_Text_Display *d) {
+  return diff_display(d)->diff_style_buffer();
+}
+void go_fltk_DiffDisplay_set_peer(Fl_Text_Display *d, Fl_Text_Display *peer) {
+  diff_display(d)->set_peer(diff_display(peer));
+}
+void go_fltk_DiffDisplay_clear_alignment(Fl_Text_Display *d) {
+  diff_display(d)->clear_alignment();
+}
+void go_fltk_DiffDisplay_append_alignment(Fl_Text_Display *d, const int *peerLines, int count, int peerEnd) {
+  diff_display(d)->append_alignment(peerLines, count, peerEnd);
+}
+void go_fltk_DiffDisplay_scroll_to_line(Fl_Text_Display *d, int line) {
+  diff_display(d)->scroll_to_line(line);
+}
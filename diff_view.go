@@ -0,0 +1,333 @@
+package fltk_go
+
+/*
+#include <stdlib.h>
+#include "diff_view.h"
+#include "tile.h"
+*/
+import "C"
+import (
+	"context"
+	"strings"
+	"time"
+	"unicode/utf8"
+	"unsafe"
+
+	"github.com/george012/fltk_go/linediff"
+)
+
+// DiffView shows two texts side by side with their differences highlighted.
+// The diff is computed in a goroutine and its hunks are shown as they are
+// found; the two sides scroll together, keeping matching lines side by side.
+//
+// As with RunOnUI, which streams the hunks to the UI thread, Lock must have
+// been called before SetTexts.
+type DiffView struct {
+	Tile
+	left, right       *TextDisplay
+	font              Font
+	size              int
+	hunks             []linediff.Hunk
+	run               *diffRun
+	doneCb            func([]linediff.Hunk)
+	deletionHandlerId uintptr
+}
+
+// the styles of the style buffers
+const (
+	diffStylePlain    = 'A'
+	diffStyleDeleted  = 'B'
+	diffStyleInserted = 'C'
+	// the changed part of a line paired with another one
+	diffStyleDeletedChars  = 'D'
+	diffStyleInsertedChars = 'E'
+)
+
+const (
+	// how often found hunks are sent to the UI thread
+	diffBatchInterval = 50 * time.Millisecond
+	// lines shown above a hunk by ShowHunk
+	diffContextLines = 3
+)
+
+// diffRun is a diff being computed; it is stopped by cancel when the texts
+// are replaced or the view is destroyed.
+type diffRun struct {
+	cancel context.CancelFunc
+}
+
+// diffBatch holds the hunks found since the previous batch, with the style
+// changes and the alignment of each side up to the end of the last hunk;
+// end holds the line of the peer matching the line after it.
+type diffBatch struct {
+	hunks  []linediff.Hunk
+	styles [2][]diffStyle
+	align  [2][]C.int
+	end    [2]int
+}
+
+type diffStyle struct {
+	pos   int
+	style string
+}
+
+func NewDiffView(x, y, w, h int, text ...string) *DiffView {
+	v := &DiffView{font: COURIER, size: 14}
+	initWidget(v, unsafe.Pointer(C.go_fltk_new_Tile(C.int(x), C.int(y), C.int(w), C.int(h), cStringOpt(text))))
+	v.left = &TextDisplay{}
+	initWidget(v.left, unsafe.Pointer(C.go_fltk_new_DiffDisplay(C.int(x), C.int(y), C.int(w/2), C.int(h), nil)))
+	v.right = &TextDisplay{}
+	initWidget(v.right, unsafe.Pointer(C.go_fltk_new_DiffDisplay(C.int(x+w/2), C.int(y), C.int(w-w/2), C.int(h), nil)))
+	v.End()
+	C.go_fltk_DiffDisplay_set_peer(v.display(v.left), v.display(v.right))
+	v.setStyles()
+	v.deletionHandlerId = v.addDeletionHandler(v.onDelete)
+	return v
+}
+
+func (v *DiffView) onDelete() {
+	v.stop()
+	if v.deletionHandlerId > 0 {
+		globalCallbackMap.unregister(v.deletionHandlerId)
+	}
+	v.deletionHandlerId = 0
+}
+
+func (v *DiffView) display(side *TextDisplay) *C.Fl_Text_Display {
+	return (*C.Fl_Text_Display)(side.ptr())
+}
+
+func (v *DiffView) styleBuffer(side *TextDisplay) *TextBuffer {
+	return &TextBuffer{cPtr: C.go_fltk_DiffDisplay_style_buffer(v.display(side))}
+}
+
+func (v *DiffView) setStyles() {
+	plain := StyleTableEntry{Color: FOREGROUND_COLOR, Font: v.font, Size: v.size}
+	deleted, inserted, deletedChars, insertedChars := plain, plain, plain, plain
+	deleted.Attr, deleted.BgColor = TEXT_ATTR_BGCOLOR_EXT, ColorFromRgb(255, 225, 225)
+	inserted.Attr, inserted.BgColor = TEXT_ATTR_BGCOLOR_EXT, ColorFromRgb(225, 250, 225)
+	deletedChars.Attr, deletedChars.BgColor = TEXT_ATTR_BGCOLOR, ColorFromRgb(255, 175, 175)
+	insertedChars.Attr, insertedChars.BgColor = TEXT_ATTR_BGCOLOR, ColorFromRgb(170, 235, 170)
+	for _, side := range []*TextDisplay{v.left, v.right} {
+		side.SetTextFont(v.font)
+		side.SetTextSize(v.size)
+		side.SetHighlightData(v.styleBuffer(side), []StyleTableEntry{plain, deleted, inserted, deletedChars, insertedChars})
+	}
+}
+
+// Left returns the display of the old text.
+func (v *DiffView) Left() *TextDisplay {
+	return v.left
+}
+
+// Right returns the display of the new text.
+func (v *DiffView) Right() *TextDisplay {
+	return v.right
+}
+
+func (v *DiffView) SetTextFont(font Font) {
+	v.font = font
+	v.setStyles()
+}
+
+func (v *DiffView) SetTextSize(size int) {
+	v.size = size
+	v.setStyles()
+}
+
+// SetDoneCallback sets the function called with all the hunks once the diff
+// of the texts is complete.
+func (v *DiffView) SetDoneCallback(cb func([]linediff.Hunk)) {
+	v.doneCb = cb
+}
+
+// Hunks returns the hunks found so far.
+func (v *DiffView) Hunks() []linediff.Hunk {
+	return append([]linediff.Hunk(nil), v.hunks...)
+}
+
+// ShowHunk scrolls both sides to the i-th hunk.
+func (v *DiffView) ShowHunk(i int) {
+	if i < 0 || i >= len(v.hunks) {
+		return
+	}
+	C.go_fltk_DiffDisplay_scroll_to_line(v.display(v.left), C.int(v.hunks[i].A+1-diffContextLines))
+}
+
+func (v *DiffView) stop() {
+	if v.run != nil {
+		v.run.cancel()
+		v.run = nil
+	}
+}
+
+// SetTexts shows the two texts and starts comparing them.
+func (v *DiffView) SetTexts(left, right string) {
+	v.stop()
+	v.hunks = nil
+	for i, side := range []*TextDisplay{v.left, v.right} {
+		text := left
+		if i == 1 {
+			text = right
+		}
+		// styles first, so that the display never sees them shorter
+		v.styleBuffer(side).SetText(strings.Repeat(string(rune(diffStylePlain)), len(text)))
+		side.Buffer().SetText(text)
+		C.go_fltk_DiffDisplay_clear_alignment(v.display(side))
+	}
+
+	ctx, cancel := context.WithCancel(context.Background())
+	run := &diffRun{cancel: cancel}
+	v.run = run
+	go computeDiff(ctx, left, right, func(batch *diffBatch, done bool) {
+		RunOnUI(func() {
+			if v.run != run {
+				return
+			}
+			v.apply(batch)
+			if done {
+				v.stop()
+				if v.doneCb != nil {
+					v.doneCb(v.Hunks())
+				}
+			}
+		})
+	})
+}
+
+func (v *DiffView) apply(batch *diffBatch) {
+	v.hunks = append(v.hunks, batch.hunks...)
+	for i, side := range []*TextDisplay{v.left, v.right} {
+		styles := v.styleBuffer(side)
+		for _, s := range batch.styles[i] {
+			styles.ReplaceRange(s.pos, s.pos+len(s.style), s.style)
+		}
+		var align *C.int
+		if len(batch.align[i]) > 0 {
+			align = &batch.align[i][0]
+		}
+		C.go_fltk_DiffDisplay_append_alignment(v.display(side), align, C.int(len(batch.align[i])), C.int(batch.end[i]))
+		side.Redraw()
+	}
+}
+
+// diffText is one side of a diff split into lines, which do not include
+// their newline; starts holds the position of each line and the length.
+type diffText struct {
+	lines  []string
+	starts []int
+}
+
+func splitDiffText(text string) diffText {
+	t := diffText{lines: strings.SplitAfter(text, "\n")}
+	if len(t.lines) > 0 && t.lines[len(t.lines)-1] == "" {
+		t.lines = t.lines[:len(t.lines)-1]
+	}
+	t.starts = make([]int, len(t.lines)+1)
+	pos := 0
+	for i, line := range t.lines {
+		t.starts[i] = pos
+		pos += len(line)
+		t.lines[i] = strings.TrimSuffix(line, "\n")
+	}
+	t.starts[len(t.lines)] = pos
+	return t
+}
+
+// computeDiff compares the texts and sends the hunks to send in batches,
+// the last one with done set.
+func computeDiff(ctx context.Context, left, right string, send func(batch *diffBatch, done bool)) {
+	a, b := splitDiffText(left), splitDiffText(right)
+	batch := &diffBatch{}
+	sent := time.Now()
+	// the lines of each side aligned so far
+	aligned := [2]int{}
+	err := linediff.Diff(ctx, a.lines, b.lines, func(h linediff.Hunk) {
+		batch.hunks = append(batch.hunks, h)
+		batch.align[0] = appendDiffAlignment(batch.align[0], aligned[0], h.A, h.Deleted, h.B, h.Inserted)
+		batch.align[1] = appendDiffAlignment(batch.align[1], aligned[1], h.B, h.Inserted, h.A, h.Deleted)
+		aligned = [2]int{h.A + h.Deleted, h.B + h.Inserted}
+		batch.end = [2]int{aligned[1], aligned[0]}
+
+		deleted := diffHunkStyle(a, h.A, h.Deleted, diffStyleDeleted)
+		inserted := diffHunkStyle(b, h.B, h.Inserted, diffStyleInserted)
+		for i := 0; i < h.Deleted && i < h.Inserted; i++ {
+			markChangedChars(a.lines[h.A+i], b.lines[h.B+i],
+				deleted[a.starts[h.A+i]-a.starts[h.A]:], inserted[b.starts[h.B+i]-b.starts[h.B]:])
+		}
+		if len(deleted) > 0 {
+			batch.styles[0] = append(batch.styles[0], diffStyle{a.starts[h.A], string(deleted)})
+		}
+		if len(inserted) > 0 {
+			batch.styles[1] = append(batch.styles[1], diffStyle{b.starts[h.B], string(inserted)})
+		}
+
+		if time.Since(sent) >= diffBatchInterval {
+			send(batch, false)
+			batch = &diffBatch{}
+			sent = time.Now()
+		}
+	})
+	if err == nil {
+		// the equal lines after the last hunk
+		batch.align[0] = appendDiffAlignment(batch.align[0], aligned[0], len(a.lines), 0, len(b.lines), 0)
+		batch.align[1] = appendDiffAlignment(batch.align[1], aligned[1], len(b.lines), 0, len(a.lines), 0)
+		batch.end = [2]int{len(b.lines), len(a.lines)}
+		send(batch, true)
+	}
+}
+
+// appendDiffAlignment aligns the lines of one side from the end of the
+// previous hunk to the end of the hunk replacing count lines at line with
+// peerCount lines of the peer at peerLine. Lines of a hunk are paired in
+// order; the extra ones face the line after the peer's part of the hunk.
+func appendDiffAlignment(align []C.int, from, line, count, peerLine, peerCount int) []C.int {
+	for l := from; l < line; l++ {
+		align = append(align, C.int(peerLine-(line-l)))
+	}
+	for i := 0; i < count; i++ {
+		if i < peerCount {
+			align = append(align, C.int(peerLine+i))
+		} else {
+			align = append(align, C.int(peerLine+peerCount))
+		}
+	}
+	return align
+}
+
+func diffHunkStyle(t diffText, line, count int, style byte) []byte {
+	return []byte(strings.Repeat(string(rune(style)), t.starts[line+count]-t.starts[line]))
+}
+
+// markChangedChars marks the part of two paired lines between their common
+// prefix and suffix in their styles. Lines with nothing in common are left
+// as they are, as the whole line is already marked.
+func markChangedChars(a, b string, aStyle, bStyle []byte) {
+	prefix := 0
+	for prefix < len(a) && prefix < len(b) && a[prefix] == b[prefix] {
+		prefix++
+	}
+	for prefix > 0 && (!diffRuneStart(a, prefix) || !diffRuneStart(b, prefix)) {
+		prefix--
+	}
+	suffix := 0
+	for suffix < len(a)-prefix && suffix < len(b)-prefix && a[len(a)-1-suffix] == b[len(b)-1-suffix] {
+		suffix++
+	}
+	for suffix > 0 && (!diffRuneStart(a, len(a)-suffix) || !diffRuneStart(b, len(b)-suffix)) {
+		suffix--
+	}
+	if prefix+suffix == 0 {
+		return
+	}
+	for i := prefix; i < len(a)-suffix; i++ {
+		aStyle[i] = diffStyleDeletedChars
+	}
+	for i := prefix; i < len(b)-suffix; i++ {
+		bStyle[i] = diffStyleInsertedChars
+	}
+}
+
+func diffRuneStart(s string, i int) bool {
+	return i >= len(s) || utf8.RuneStart(s[i])
+}
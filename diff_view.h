@@ -0,0 +1,20 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  typedef struct Fl_Text_Display Fl_Text_Display;
+  typedef struct Fl_Text_Buffer Fl_Text_Buffer;
+
+  extern Fl_Text_Display *go_fltk_new_DiffDisplay(int x, int y, int w, int h, const char *label);
+
+  extern Fl_Text_Buffer *go_fltk_DiffDisplay_style_buffer(Fl_Text_Display *d);
+  extern void go_fltk_DiffDisplay_set_peer(Fl_Text_Display *d, Fl_Text_Display *peer);
+  extern void go_fltk_DiffDisplay_clear_alignment(Fl_Text_Display *d);
+  extern void go_fltk_DiffDisplay_append_alignment(Fl_Text_Display *d, const int *peerLines, int count, int peerEnd);
+  extern void go_fltk_DiffDisplay_scroll_to_line(Fl_Text_Display *d, int line);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,114 @@
+package fltk_go
+
+import (
+	"context"
+	"reflect"
+	"strings"
+	"testing"
+)
+
+func diffAlignmentInts(align []_Ctype_int) []int {
+	res := make([]int, len(align))
+	for i, line := range align {
+		res[i] = int(line)
+	}
+	return res
+}
+
+func TestAppendDiffAlignment(t *testing.T) {
+	for _, c := range []struct {
+		name                                   string
+		from, line, count, peerLine, peerCount int
+		want                                   []int
+	}{
+		{"equal lines", 0, 3, 0, 3, 0, []int{0, 1, 2}},
+		{"shifted equal lines", 2, 4, 0, 7, 0, []int{5, 6}},
+		{"deletion", 0, 2, 3, 2, 0, []int{0, 1, 2, 2, 2}},
+		{"insertion", 0, 2, 0, 2, 3, []int{0, 1}},
+		{"longer replacement", 0, 1, 3, 1, 2, []int{0, 1, 2, 3}},
+		{"shorter replacement", 0, 1, 2, 1, 3, []int{0, 1, 2}},
+	} {
+		got := diffAlignmentInts(appendDiffAlignment(nil, c.from, c.line, c.count, c.peerLine, c.peerCount))
+		if !reflect.DeepEqual(got, c.want) {
+			t.Errorf("%s: got %v, want %v", c.name, got, c.want)
+		}
+	}
+}
+
+// the alignment sent by computeDiff covers every line of both sides, so
+// that the lines after the last hunk stay side by side
+func TestComputeDiffAlignment(t *testing.T) {
+	var left, right string
+	for i := 0; i < 20; i++ {
+		line := string(rune('a'+i)) + "\n"
+		if i < 10 || i >= 13 {
+			left += line
+		}
+		right += line
+	}
+	var align [2][]int
+	var end [2]int
+	computeDiff(context.Background(), right, left, func(batch *diffBatch, done bool) {
+		for i := range align {
+			align[i] = append(align[i], diffAlignmentInts(batch.align[i])...)
+		}
+		end = batch.end
+	})
+	if len(align[0]) != 20 || len(align[1]) != 17 {
+		t.Fatalf("alignment of %d and %d lines for 20 and 17", len(align[0]), len(align[1]))
+	}
+	// the 3 lines deleted at 10 face line 10 of the right side
+	for line, want := range map[int]int{9: 9, 10: 10, 12: 10, 13: 10, 19: 16} {
+		if got := align[0][line]; got != want {
+			t.Errorf("left line %d faces %d, want %d", line, got, want)
+		}
+	}
+	for line, want := range map[int]int{9: 9, 10: 13, 16: 19} {
+		if got := align[1][line]; got != want {
+			t.Errorf("right line %d faces %d, want %d", line, got, want)
+		}
+	}
+	if end != [2]int{17, 20} {
+		t.Errorf("end %v, want [17 20]", end)
+	}
+}
+
+func TestSplitDiffText(t *testing.T) {
+	for _, c := range []struct {
+		text   string
+		lines  []string
+		starts []int
+	}{
+		{"", nil, []int{0}},
+		{"a", []string{"a"}, []int{0, 1}},
+		{"a\n", []string{"a"}, []int{0, 2}},
+		{"a\n\nbc", []string{"a", "", "bc"}, []int{0, 2, 3, 5}},
+		{"\n\n", []string{"", ""}, []int{0, 1, 2}},
+	} {
+		got := splitDiffText(c.text)
+		if len(got.lines) != len(c.lines) || (len(c.lines) > 0 && !reflect.DeepEqual(got.lines, c.lines)) || !reflect.DeepEqual(got.starts, c.starts) {
+			t.Errorf("%q: got %q %v, want %q %v", c.text, got.lines, got.starts, c.lines, c.starts)
+		}
+	}
+}
+
+func TestMarkChangedChars(t *testing.T) {
+	for _, c := range []struct {
+		a, b         string
+		aWant, bWant string
+	}{
+		{"foo(x)", "foo(y)", "AAAADA", "AAAAEA"},
+		{"abc", "xyz", "AAA", "AAA"},
+		{"abc", "abc", "AAA", "AAA"},
+		{"ab", "aXb", "AA", "AEA"},
+		// the changed part is widened to whole runes
+		{"aéb", "aèb", "ADDA", "AEEA"},
+	} {
+		aStyle := []byte(strings.Repeat(string(rune(diffStylePlain)), len(c.a)))
+		bStyle := []byte(strings.Repeat(string(rune(diffStylePlain)), len(c.b)))
+		markChangedChars(c.a, c.b, aStyle, bStyle)
+		if string(aStyle) != c.aWant || string(bStyle) != c.bWant {
+			t.Errorf("%q %q: got %s %s, want %s %s", c.a, c.b, aStyle, bStyle, c.aWant, c.bWant)
+		}
+	}
+}
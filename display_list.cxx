@@ -0,0 +1,204 @@
+#include "display_list.h"
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <FL/fl_draw.H>
+#include <FL/Enumerations.H>
+
+
+enum DisplayListOp {
+  DL_COLOR = 1,
+  DL_LINE_STYLE,
+  DL_FONT,
+  DL_POINT,
+  DL_LINE,
+  DL_RECT,
+  DL_RECTF,
+  DL_ARC,
+  DL_PIE,
+  DL_POLYLINE,
+  DL_LOOP,
+  DL_POLYGON,
+  DL_TEXT,
+  DL_BOX,
+  DL_PUSH_CLIP,
+  DL_POP_CLIP,
+};
+
+struct DisplayListData {
+  std::vector<int32_t> ops;
+  std::string text;  // NUL separated strings referenced by DL_TEXT
+};
+
+static float dl_float(int32_t bits) {
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// GDisplayListPresenter holds the display list drawn by a widget.  Lists are
+// committed from any thread into a pending slot with an atomic exchange; the
+// UI thread picks up the latest one when it draws, so neither side ever waits
+// for the other.
+struct GDisplayListPresenter {
+  ~GDisplayListPresenter() {
+    delete m_pending.exchange(nullptr);
+    delete m_current;
+  }
+
+  void commit(DisplayListData *list) {
+    // a list committed but never drawn is simply superseded
+    delete m_pending.exchange(list);
+  }
+
+  void draw(int ox, int oy) {
+    if (DisplayListData *list = m_pending.exchange(nullptr)) {
+      delete m_current;
+      m_current = list;
+    }
+    if (m_current) {
+      replay(*m_current, ox, oy);
+    }
+  }
+
+private:
+  static void replay(const DisplayListData &list, int ox, int oy) {
+    const int32_t *op = list.ops.data();
+    const int32_t *end = op + list.ops.size();
+    int clips = 0;
+    while (op < end) {
+      switch (*op++) {
+      case DL_COLOR:
+        fl_color((Fl_Color)(uint32_t)op[0]);
+        op += 1;
+        break;
+      case DL_LINE_STYLE:
+        fl_line_style(op[0], op[1]);
+        op += 2;
+        break;
+      case DL_FONT:
+        fl_font((Fl_Font)op[0], op[1]);
+        op += 2;
+        break;
+      case DL_POINT:
+        fl_point(ox + op[0], oy + op[1]);
+        op += 2;
+        break;
+      case DL_LINE:
+        fl_line(ox + op[0], oy + op[1], ox + op[2], oy + op[3]);
+        op += 4;
+        break;
+      case DL_RECT:
+        fl_rect(ox + op[0], oy + op[1], op[2], op[3]);
+        op += 4;
+        break;
+      case DL_RECTF:
+        fl_rectf(ox + op[0], oy + op[1], op[2], op[3]);
+        op += 4;
+        break;
+      case DL_ARC:
+        fl_arc(ox + op[0], oy + op[1], op[2], op[3], dl_float(op[4]), dl_float(op[5]));
+        op += 6;
+        break;
+      case DL_PIE:
+        fl_pie(ox + op[0], oy + op[1], op[2], op[3], dl_float(op[4]), dl_float(op[5]));
+        op += 6;
+        break;
+      case DL_POLYLINE:
+      case DL_LOOP:
+      case DL_POLYGON: {
+        const int kind = op[-1];
+        const int n = op[0];
+        op += 1;
+        if (kind == DL_POLYGON) {
+          fl_begin_complex_polygon();
+        } else if (kind == DL_LOOP) {
+          fl_begin_loop();
+        } else {
+          fl_begin_line();
+        }
+        for (int i = 0; i < n; i++) {
+          fl_vertex(ox + op[2 * i], oy + op[2 * i + 1]);
+        }
+        op += 2 * n;
+        if (kind == DL_POLYGON) {
+          fl_end_complex_polygon();
+        } else if (kind == DL_LOOP) {
+          fl_end_loop();
+        } else {
+          fl_end_line();
+        }
+        break;
+      }
+      case DL_TEXT:
+        fl_draw(list.text.c_str() + op[5], ox + op[0], oy + op[1], op[2], op[3], (Fl_Align)op[4]);
+        op += 6;
+        break;
+      case DL_BOX:
+        fl_draw_box((Fl_Boxtype)op[0], ox + op[1], oy + op[2], op[3], op[4], (Fl_Color)(uint32_t)op[5]);
+        op += 6;
+        break;
+      case DL_PUSH_CLIP:
+        fl_push_clip(ox + op[0], oy + op[1], op[2], op[3]);
+        clips++;
+        op += 4;
+        break;
+      case DL_POP_CLIP:
+        if (clips > 0) {
+          fl_pop_clip();
+          clips--;
+        }
+        break;
+      default:
+        // unknown op, the rest of the list cannot be decoded
+        op = end;
+        break;
+      }
+    }
+    for (; clips > 0; clips--) {
+      fl_pop_clip();
+    }
+    fl_line_style(0);
+  }
+
+  std::atomic<DisplayListData*> m_pending{nullptr};
+  DisplayListData *m_current = nullptr;
+};
+
+GDisplayListPresenter *go_fltk_new_DisplayListPresenter(void) {
+  return new GDisplayListPresenter();
+}
+void go_fltk_DisplayListPresenter_delete(GDisplayListPresenter *p) {
+  delete p;
+}
+void go_fltk_DisplayListPresenter_commit(GDisplayListPresenter *p, const int32_t *ops, int opCount, const char *text, int textLen) {
+  DisplayListData *list = new DisplayListData();
+  list->ops.assign(ops, ops + opCount);
+  if (textLen > 0) {
+    list->text.assign(text, textLen);
+  }
+  p->commit(list);
+}
+void go_fltk_DisplayListPresenter_draw(GDisplayListPresenter *p, int x, int y) {
+  p->draw(x, y);
+}
+
+const int go_DL_COLOR = DL_COLOR;
+const int go_DL_LINE_STYLE = DL_LINE_STYLE;
+const int go_DL_FONT = DL_FONT;
+const int go_DL_POINT = DL_POINT;
+const int go_DL_LINE = DL_LINE;
+const int go_DL_RECT = DL_RECT;
+const int go_DL_RECTF = DL_RECTF;
+const int go_DL_ARC = DL_ARC;
+const int go_DL_PIE = DL_PIE;
+const int go_DL_POLYLINE = DL_POLYLINE;
+const int go_DL_LOOP = DL_LOOP;
+const int go_DL_POLYGON = DL_POLYGON;
+const int go_DL_TEXT = DL_TEXT;
+const int go_DL_BOX = DL_BOX;
+const int go_DL_PUSH_CLIP = DL_PUSH_CLIP;
+const int go_DL_POP_CLIP = DL_POP_CLIP;
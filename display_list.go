@@ -0,0 +1,197 @@
+package fltk_go
+
+/*
+#include "display_list.h"
+*/
+import "C"
+import (
+	"math"
+	"sync"
+	"sync/atomic"
+	"unsafe"
+)
+
+var (
+	dlColor     = int32(C.go_DL_COLOR)
+	dlLineStyle = int32(C.go_DL_LINE_STYLE)
+	dlFont      = int32(C.go_DL_FONT)
+	dlPoint     = int32(C.go_DL_POINT)
+	dlLine      = int32(C.go_DL_LINE)
+	dlRect      = int32(C.go_DL_RECT)
+	dlRectf     = int32(C.go_DL_RECTF)
+	dlArc       = int32(C.go_DL_ARC)
+	dlPie       = int32(C.go_DL_PIE)
+	dlPolyline  = int32(C.go_DL_POLYLINE)
+	dlLoop      = int32(C.go_DL_LOOP)
+	dlPolygon   = int32(C.go_DL_POLYGON)
+	dlText      = int32(C.go_DL_TEXT)
+	dlBox       = int32(C.go_DL_BOX)
+	dlPushClip  = int32(C.go_DL_PUSH_CLIP)
+	dlPopClip   = int32(C.go_DL_POP_CLIP)
+)
+
+// DisplayList records drawing commands to be replayed later by a
+// DisplayListPresenter. Recording does not call into FLTK, so a list can be
+// built on any goroutine while the UI thread keeps drawing the previous one.
+//
+// The methods mirror the package level drawing functions. Coordinates are
+// relative to the top left corner of the widget the list is presented on.
+type DisplayList struct {
+	ops  []int32
+	text []byte
+}
+
+func NewDisplayList() *DisplayList {
+	return &DisplayList{}
+}
+
+// Reset empties the list, keeping its memory for the next recording.
+func (d *DisplayList) Reset() {
+	d.ops = d.ops[:0]
+	d.text = d.text[:0]
+}
+
+func (d *DisplayList) Len() int {
+	return len(d.ops)
+}
+
+func (d *DisplayList) op(op int32, args ...int) {
+	d.ops = append(d.ops, op)
+	for _, a := range args {
+		d.ops = append(d.ops, int32(a))
+	}
+}
+
+func (d *DisplayList) SetDrawColor(color Color) {
+	d.ops = append(d.ops, dlColor, int32(uint32(color)))
+}
+func (d *DisplayList) SetLineStyle(style LineStyle, width int) {
+	d.op(dlLineStyle, int(style), width)
+}
+func (d *DisplayList) SetDrawFont(font Font, size int) {
+	d.op(dlFont, int(font), size)
+}
+func (d *DisplayList) DrawPoint(x, y int) {
+	d.op(dlPoint, x, y)
+}
+func (d *DisplayList) DrawLine(x, y, x1, y1 int) {
+	d.op(dlLine, x, y, x1, y1)
+}
+func (d *DisplayList) DrawRect(x, y, w, h int) {
+	d.op(dlRect, x, y, w, h)
+}
+func (d *DisplayList) DrawRectf(x, y, w, h int) {
+	d.op(dlRectf, x, y, w, h)
+}
+func (d *DisplayList) DrawArc(x, y, w, h int, a1, a2 float64) {
+	d.op(dlArc, x, y, w, h)
+	d.ops = append(d.ops, int32(math.Float32bits(float32(a1))), int32(math.Float32bits(float32(a2))))
+}
+func (d *DisplayList) DrawPie(x, y, w, h int, a1, a2 float64) {
+	d.op(dlPie, x, y, w, h)
+	d.ops = append(d.ops, int32(math.Float32bits(float32(a1))), int32(math.Float32bits(float32(a2))))
+}
+
+func (d *DisplayList) vertices(op int32, points []int) {
+	d.op(op, len(points)/2)
+	for i := 0; i+1 < len(points); i += 2 {
+		d.ops = append(d.ops, int32(points[i]), int32(points[i+1]))
+	}
+}
+
+// DrawPolyline draws lines through the points, given as x0, y0, x1, y1, ...
+func (d *DisplayList) DrawPolyline(points ...int) {
+	d.vertices(dlPolyline, points)
+}
+
+// DrawLoop draws the outline of the polygon through the points.
+func (d *DisplayList) DrawLoop(points ...int) {
+	d.vertices(dlLoop, points)
+}
+
+// DrawPolygon fills the polygon through the points.
+func (d *DisplayList) DrawPolygon(points ...int) {
+	d.vertices(dlPolygon, points)
+}
+
+func (d *DisplayList) Draw(text string, x, y, w, h int, align Align) {
+	d.op(dlText, x, y, w, h, int(align), len(d.text))
+	d.text = append(d.text, text...)
+	d.text = append(d.text, 0)
+}
+func (d *DisplayList) DrawBox(boxType BoxType, x, y, w, h int, color Color) {
+	d.op(dlBox, int(boxType), x, y, w, h)
+	d.ops = append(d.ops, int32(uint32(color)))
+}
+func (d *DisplayList) PushClip(x, y, w, h int) {
+	d.op(dlPushClip, x, y, w, h)
+}
+func (d *DisplayList) PopClip() {
+	d.op(dlPopClip)
+}
+
+// DisplayListPresenter draws the most recently committed DisplayList on a
+// widget. It replaces the widget's draw handler; the widget's own drawing
+// happens first and the list is replayed on top of it.
+type DisplayListPresenter struct {
+	w                 *widget
+	mu                sync.Mutex // guards ptr against the widget being deleted
+	ptr               *C.GDisplayListPresenter
+	deletionHandlerId uintptr
+	redrawQueue       int32
+}
+
+func NewDisplayListPresenter(w Widget) *DisplayListPresenter {
+	p := &DisplayListPresenter{
+		w:   w.getWidget(),
+		ptr: C.go_fltk_new_DisplayListPresenter(),
+	}
+	p.w.SetDrawHandler(func(baseDraw func()) {
+		baseDraw()
+		C.go_fltk_DisplayListPresenter_draw(p.ptr, C.int(p.w.X()), C.int(p.w.Y()))
+	})
+	p.deletionHandlerId = p.w.addDeletionHandler(p.onDelete)
+	return p
+}
+
+func (p *DisplayListPresenter) onDelete() {
+	globalCallbackMap.unregister(p.deletionHandlerId)
+	p.mu.Lock()
+	defer p.mu.Unlock()
+	C.go_fltk_DisplayListPresenter_delete(p.ptr)
+	p.ptr = nil
+}
+
+// Commit makes list the content of the widget and schedules a redraw. It may
+// be called from any goroutine; list is copied, so it can be reset and
+// reused for the next frame right away. Lists committed faster than the
+// widget is redrawn are dropped except for the latest one.
+//
+// As with Awake, Lock must have been called on the UI thread before lists
+// are committed from other goroutines.
+func (p *DisplayListPresenter) Commit(list *DisplayList) {
+	var ops *C.int32_t
+	if len(list.ops) > 0 {
+		ops = (*C.int32_t)(unsafe.Pointer(&list.ops[0]))
+	}
+	var text *C.char
+	if len(list.text) > 0 {
+		text = (*C.char)(unsafe.Pointer(&list.text[0]))
+	}
+	p.mu.Lock()
+	if p.ptr == nil {
+		p.mu.Unlock()
+		return
+	}
+	C.go_fltk_DisplayListPresenter_commit(p.ptr, ops, C.int(len(list.ops)), text, C.int(len(list.text)))
+	p.mu.Unlock()
+
+	if atomic.CompareAndSwapInt32(&p.redrawQueue, 0, 1) {
+		Awake(func() {
+			atomic.StoreInt32(&p.redrawQueue, 0)
+			if p.w.exists() {
+				p.w.Redraw()
+			}
+		})
+	}
+}
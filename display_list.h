@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  typedef struct GDisplayListPresenter GDisplayListPresenter;
+
+  extern GDisplayListPresenter *go_fltk_new_DisplayListPresenter(void);
+  extern void go_fltk_DisplayListPresenter_delete(GDisplayListPresenter *p);
+  extern void go_fltk_DisplayListPresenter_commit(GDisplayListPresenter *p, const int32_t *ops, int opCount, const char *text, int textLen);
+  extern void go_fltk_DisplayListPresenter_draw(GDisplayListPresenter *p, int x, int y);
+
+  extern const int go_DL_COLOR;
+  extern const int go_DL_LINE_STYLE;
+  extern const int go_DL_FONT;
+  extern const int go_DL_POINT;
+  extern const int go_DL_LINE;
+  extern const int go_DL_RECT;
+  extern const int go_DL_RECTF;
+  extern const int go_DL_ARC;
+  extern const int go_DL_PIE;
+  extern const int go_DL_POLYLINE;
+  extern const int go_DL_LOOP;
+  extern const int go_DL_POLYGON;
+  extern const int go_DL_TEXT;
+  extern const int go_DL_BOX;
+  extern const int go_DL_PUSH_CLIP;
+  extern const int go_DL_POP_CLIP;
+
+#ifdef __cplusplus
+}
+#endif
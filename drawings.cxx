@@ -1,5 +1,7 @@
 #include "drawings.h"
 
+#include "png_encoder.h"
+
 #include <FL/fl_draw.H>
 #include <FL/platform.H>
 #include <FL/Enumerations.H>
@@ -455,6 +457,18 @@ void go_fltk_rescale_offscreen(GOffscreen **ctx) {
     fl_rescale_offscreen(*(Fl_Offscreen *)ctx);
 }
 
+GPngBuffer *go_fltk_offscreen_encode_png(GOffscreen *o, int w, int h, int level) {
+    fl_begin_offscreen((Fl_Offscreen)o);
+    uchar *pixels = fl_read_image(NULL, 0, 0, w, h, 0);
+    fl_end_offscreen();
+    if (!pixels) {
+        return NULL;
+    }
+    GPngBuffer *png = go_fltk_png_encode(pixels, w, h, 3, w * 3, level);
+    delete[] pixels;
+    return png;
+}
+
 void go_fltk_draw_text2(const char *str, int x, int y, int w, int h, int align) {
     fl_draw(str, x, y, w, h, (Fl_Align)align, 0, 1);
 }
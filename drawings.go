@@ -5,7 +5,10 @@ package fltk_go
 #include "drawings.h"
 */
 import "C"
-import "unsafe"
+import (
+	"io"
+	"unsafe"
+)
 
 func SetDrawColor(color Color) {
 	C.go_fltk_color(C.uint(color))
@@ -189,11 +192,14 @@ func DrawCheck(x, y, w, h int, col Color) {
 
 type Offscreen struct {
 	oPtr *C.GOffscreen
+	w, h int
 }
 
 func NewOffscreen(w, h int) *Offscreen {
 	o := &Offscreen{
 		oPtr: C.go_fltk_create_offscreen(C.int(w), C.int(h)),
+		w:    w,
+		h:    h,
 	}
 	return o
 }
@@ -218,6 +224,13 @@ func (offs *Offscreen) IsValid() bool {
 	return offs.oPtr != nil
 }
 
+// EncodePNG writes the contents of the offscreen as PNG. The pixels are read
+// back and compressed without passing through Go memory. It must not be
+// called between Begin and End.
+func (offs *Offscreen) EncodePNG(out io.Writer, level int) error {
+	return writePNGBuffer(out, C.go_fltk_offscreen_encode_png(offs.oPtr, C.int(offs.w), C.int(offs.h), C.int(level)))
+}
+
 func (offs *Offscreen) Copy(x, y, w, h, srcx, srcy int) {
 	C.go_fltk_copy_offscreen(C.int(x), C.int(y), C.int(w), C.int(h), offs.oPtr, C.int(srcx), C.int(srcy))
 }
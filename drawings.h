@@ -5,6 +5,7 @@ extern "C" {
 #endif
 
   typedef struct GOffscreen GOffscreen;
+  typedef struct GPngBuffer GPngBuffer;
   
   extern void go_fltk_color(unsigned int color);
   extern void go_fltk_set_draw_font(int font, int size);
@@ -122,6 +123,7 @@ extern "C" {
   extern void go_fltk_end_offscreen(void);
   extern void go_fltk_delete_offscreen(GOffscreen *bitmap);
   extern void go_fltk_rescale_offscreen(GOffscreen **ctx);
+  extern GPngBuffer *go_fltk_offscreen_encode_png(GOffscreen *o, int w, int h, int level);
   extern void go_fltk_draw_text2(const char *str, int x, int y, int w, int h, int align);
   extern void go_fltk_draw_check(int x, int y, int w, int h, unsigned int col);
 
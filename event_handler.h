@@ -4,6 +4,11 @@
 
 #include <vector>
 
+#include <FL/Fl_Group.H>
+
+#include "lazy_tooltip.h"
+#include "widget_handle.h"
+
 
 class WidgetWithEventHandler {
 public:
@@ -22,28 +27,65 @@ class WidgetWithDeletionHandler {
 public:
   virtual void add_deletion_handler(uintptr_t handlerId) = 0;
 };
+class WidgetWithTooltipProvider {
+public:
+  virtual void set_tooltip_provider(uintptr_t providerId) = 0;
+};
+class WidgetWithHandle {
+public:
+  virtual uint64_t widget_handle() = 0;
+};
+class WidgetWithDelegatedEventHandler {
+public:
+  virtual void set_delegated_event_handler(int handlerId) = 0;
+  virtual int delegated_event_handler() const = 0;
+};
+
+// the number of widgets with a delegated event handler; events look for one
+// among the ancestors of their widget only while there is one
+inline int &delegated_event_handler_count() {
+  static int count = 0;
+  return count;
+}
 
 template<class BaseWidget>
-class EventHandler : public BaseWidget, public WidgetWithEventHandler, public WidgetWithDrawHandler, public WidgetWithResizeHandler, public WidgetWithDeletionHandler {
+class EventHandler : public BaseWidget, public WidgetWithEventHandler, public WidgetWithDrawHandler, public WidgetWithResizeHandler, public WidgetWithDeletionHandler, public WidgetWithTooltipProvider, public WidgetWithHandle, public WidgetWithDelegatedEventHandler, public TooltipSource {
 public:
   template<class... Arg>
   EventHandler(Arg... args)
     : BaseWidget(args...) {}
 
   virtual ~EventHandler() {
+    WidgetHandles::instance().release(m_handle);
+    set_delegated_event_handler(-1);
+    delete m_tooltip;
     for (uintptr_t deletionHandlerId : m_deletionHandlerIds) {
       _go_callbackHandler(deletionHandlerId);
     }
   }
 
   int handle(int event) final {
+    if (m_tooltip) {
+      m_tooltip->handle(event);
+    }
     if (m_eventHandlerId >= 0) {
       const int ret = _go_eventHandler(m_eventHandlerId, event);
       if (ret != 0) {
         return ret;
       }
     }
-    return BaseWidget::handle(event);
+    if (delegated_event_handler_count() > 0) {
+      const int ret = delegate_event(event);
+      if (ret != 0) {
+        return ret;
+      }
+    }
+    const int ret = BaseWidget::handle(event);
+    // a widget with a tooltip provider needs FL_MOVE events
+    if (m_tooltip && (event == FL_ENTER || event == FL_MOVE)) {
+      return 1;
+    }
+    return ret;
   }
 
   void draw() override {
@@ -82,9 +124,56 @@ public:
     m_deletionHandlerIds.push_back(handlerId);
   }
 
+  void set_tooltip_provider(uintptr_t providerId) final {
+    delete m_tooltip;
+    m_tooltip = providerId ? new LazyTooltip(this, this, providerId) : NULL;
+  }
+
+  void set_delegated_event_handler(int handlerId) final {
+    delegated_event_handler_count() += (handlerId >= 0) - (m_delegatedEventHandlerId >= 0);
+    m_delegatedEventHandlerId = handlerId;
+  }
+
+  int delegated_event_handler() const final {
+    return m_delegatedEventHandlerId;
+  }
+
+  uint64_t widget_handle() final {
+    if (m_handle == 0) {
+      m_handle = WidgetHandles::instance().acquire(this);
+    }
+    return m_handle;
+  }
+
+  // the whole widget is one item unless a widget overrides this
+  bool tooltip_item(int &a, int &b, void *&item, int &X, int &Y, int &W, int &H) override {
+    a = b = 0;
+    item = NULL;
+    X = this->x(), Y = this->y(), W = this->w(), H = this->h();
+    return true;
+  }
+
 protected:
+  // offers the event to the delegated event handlers of the ancestors of the
+  // widget, the nearest first, until one of them handles it
+  int delegate_event(int event) {
+    for (Fl_Group *p = this->parent(); p != NULL; p = p->parent()) {
+      WidgetWithDelegatedEventHandler *d = dynamic_cast<WidgetWithDelegatedEventHandler*>(p);
+      if (d != NULL && d->delegated_event_handler() >= 0) {
+        const int ret = _go_delegatedEventHandler(d->delegated_event_handler(), event, widget_handle());
+        if (ret != 0) {
+          return ret;
+        }
+      }
+    }
+    return 0;
+  }
+
   int m_eventHandlerId = -1;
+  int m_delegatedEventHandlerId = -1;
   uintptr_t m_drawHandlerId = 0;
   uintptr_t m_resizeHandlerId = 0;
   std::vector<uintptr_t> m_deletionHandlerIds;
+  LazyTooltip *m_tooltip = NULL;
+  uint64_t m_handle = 0;
 };
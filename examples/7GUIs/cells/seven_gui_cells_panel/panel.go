@@ -3,15 +3,17 @@ package seven_gui_cells_panel
 import (
 	"examples/7GUIs/cells/sven_gui_cells_context"
 	"github.com/george012/fltk_go"
+	"github.com/george012/fltk_go/spreadsheet"
 	"log"
+	"strconv"
 )
 
 type Panel struct {
 	tb         *fltk_go.TableRow
-	cellValues map[sven_gui_cells_context.CellLoc]string
+	cellValues map[spreadsheet.Cell]string
 
-	editInput *fltk_go.Input               // the input box to show on editing cell
-	editCell  *sven_gui_cells_context.Cell // current editing cell meta, nil means not editing
+	editInput *fltk_go.Input    // the input box to show on editing cell
+	editCell  *spreadsheet.Cell // current editing cell, nil means not editing
 	Ctx       *sven_gui_cells_context.Context
 }
 
@@ -20,7 +22,7 @@ func NewPanel(win *fltk_go.Window, rowCount, colCount int, aCtx *sven_gui_cells_
 		Ctx: aCtx,
 	}
 
-	p.cellValues = make(map[sven_gui_cells_context.CellLoc]string)
+	p.cellValues = make(map[spreadsheet.Cell]string)
 
 	p.tb = fltk_go.NewTableRow(0, 0, win.W(), win.H())
 	p.tb.SetRowCount(rowCount)
@@ -43,30 +45,31 @@ func NewPanel(win *fltk_go.Window, rowCount, colCount int, aCtx *sven_gui_cells_
 }
 
 func (p *Panel) Bind(ctx *sven_gui_cells_context.Context) {
-	for row := range ctx.Cells {
-		for col := range ctx.Cells[row] {
-			cell := ctx.Cells[row][col]
-			p.cellValues[cell.Loc] = cell.Data.Display()
+	for row := 0; row < ctx.MaxRow; row++ {
+		for col := 0; col < ctx.MaxCol; col++ {
+			cell := spreadsheet.Cell{Row: row, Col: col}
+			if text := ctx.Display(cell); text != "" {
+				p.cellValues[cell] = text
+			}
 		}
 	}
+	// only the cells whose value changed are redrawn after an edit
+	ctx.Sheet.OnChange(p.ApplyChangedCells)
 
-	p.tb.SetDrawCellCallback(func(tc fltk_go.TableContext, i, j, x, y, w, h int) {
-		row := sven_gui_cells_context.CellRow(i)
-		col := sven_gui_cells_context.CellCol(j)
-
+	p.tb.SetDrawCellCallback(func(tc fltk_go.TableContext, row, col, x, y, w, h int) {
 		switch tc {
 		case fltk_go.ContextRowHeader:
 			fltk_go.SetDrawFont(fltk_go.HELVETICA_BOLD, 14)
 			fltk_go.DrawBox(fltk_go.UP_BOX, x, y, w, h, fltk_go.BACKGROUND_COLOR)
 			fltk_go.SetDrawColor(fltk_go.BLACK)
-			fltk_go.Draw(row.String(), x, y, w, h, fltk_go.ALIGN_CENTER)
+			fltk_go.Draw(strconv.Itoa(row), x, y, w, h, fltk_go.ALIGN_CENTER)
 		case fltk_go.ContextColHeader:
 			fltk_go.SetDrawFont(fltk_go.HELVETICA_BOLD, 14)
 			fltk_go.DrawBox(fltk_go.UP_BOX, x, y, w, h, fltk_go.BACKGROUND_COLOR)
 			fltk_go.SetDrawColor(fltk_go.BLACK)
-			fltk_go.Draw(col.String(), x, y, w, h, fltk_go.ALIGN_CENTER)
+			fltk_go.Draw(spreadsheet.ColumnName(col), x, y, w, h, fltk_go.ALIGN_CENTER)
 		case fltk_go.ContextCell:
-			loc := sven_gui_cells_context.CellLoc{Row: row, Col: col}
+			loc := spreadsheet.Cell{Row: row, Col: col}
 			if p.IsEditingAt(col, row) {
 				p.editInput.Resize(x, y, w, h)
 				return
@@ -105,8 +108,8 @@ func (p *Panel) IsEditing() bool {
 	return p.editCell != nil
 }
 
-func (p *Panel) IsEditingAt(col sven_gui_cells_context.CellCol, row sven_gui_cells_context.CellRow) bool {
-	return p.editCell != nil && p.editCell.Loc.Col == col && p.editCell.Loc.Row == row
+func (p *Panel) IsEditingAt(col, row int) bool {
+	return p.editCell != nil && p.editCell.Col == col && p.editCell.Row == row
 }
 
 func (p *Panel) StartEditing(ctx *sven_gui_cells_context.Context) {
@@ -114,20 +117,18 @@ func (p *Panel) StartEditing(ctx *sven_gui_cells_context.Context) {
 		p.DoneEditing(ctx)
 	}
 
-	row := sven_gui_cells_context.CellRow(p.tb.CallbackRow())
-	col := sven_gui_cells_context.CellCol(p.tb.CallbackColumn())
-	loc := sven_gui_cells_context.CellLoc{Row: row, Col: col}
+	loc := spreadsheet.Cell{Row: p.tb.CallbackRow(), Col: p.tb.CallbackColumn()}
 
-	x, y, w, h, err := p.tb.FindCell(fltk_go.ContextCell, int(row), int(col))
+	x, y, w, h, err := p.tb.FindCell(fltk_go.ContextCell, loc.Row, loc.Col)
 	if err != nil {
 		log.Panic("should not go here")
 		return
 	}
 
 	// log.Print("show input:", x, y, w, h)
-	p.editCell = ctx.FindCell(loc)
+	p.editCell = &loc
 	p.editInput.Resize(x, y, w, h)
-	p.editInput.SetValue(p.editCell.RawValue)
+	p.editInput.SetValue(ctx.RawValue(loc))
 	p.editInput.Show()
 	p.editInput.TakeFocus()
 }
@@ -135,16 +136,22 @@ func (p *Panel) StartEditing(ctx *sven_gui_cells_context.Context) {
 func (p *Panel) DoneEditing(ctx *sven_gui_cells_context.Context) {
 	if p.IsEditing() {
 		// log.Print("done editing")
-		p.editCell.Update(p.editInput.Value(), p.Ctx)
-		p.ApplyChangedCells(ctx, p.editCell)
-		p.editInput.Hide()
+		cell := *p.editCell
 		p.editCell = nil
+		p.editInput.Hide()
+		ctx.Update(cell, p.editInput.Value())
+		// the edited cell may display differently even if its value is unchanged
+		p.cellValues[cell] = ctx.Display(cell)
+		p.tb.RedrawCell(cell.Row, cell.Col)
 	}
 }
 
-func (p *Panel) ApplyChangedCells(ctx *sven_gui_cells_context.Context, changedCell *sven_gui_cells_context.Cell) {
-	scells := ctx.FindAllChangedCells(changedCell)
-	for loc, scell := range scells {
-		p.cellValues[loc] = scell.Data.Display()
+func (p *Panel) ApplyChangedCells(changed []spreadsheet.Cell) {
+	for _, cell := range changed {
+		if !p.Ctx.Contains(cell) {
+			continue
+		}
+		p.cellValues[cell] = p.Ctx.Display(cell)
+		p.tb.RedrawCell(cell.Row, cell.Col)
 	}
 }
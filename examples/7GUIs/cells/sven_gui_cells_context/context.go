@@ -1,274 +1,61 @@
 package sven_gui_cells_context
 
 import (
-	"errors"
 	"fmt"
-	"math"
-	"regexp"
-	"strconv"
-	"strings"
-)
 
-var reSumFormula = regexp.MustCompile(`(?i)SUM\(([A-Z]\d+):([A-Z]\d+)\)`)
+	"github.com/george012/fltk_go/spreadsheet"
+)
 
+// Context is the cells model. Values are kept by a spreadsheet.Sheet, so an
+// edit only recalculates the cells depending on it.
 type Context struct {
-	Cells [][]*Cell
+	Sheet  *spreadsheet.Sheet
+	MaxRow int
+	MaxCol int
 }
 
 func NewContext(maxRow, maxCol int) *Context {
-	ctx := &Context{}
-	ctx.Cells = make([][]*Cell, maxRow)
-	for row := range ctx.Cells {
-		ctx.Cells[row] = make([]*Cell, maxCol)
-		for col := range ctx.Cells[row] {
-			cell := &Cell{}
-			cell.Loc.Row = CellRow(row)
-			cell.Loc.Col = CellCol(col)
-			cell.Data = &CellDataText{}
-			ctx.Cells[row][col] = cell
-		}
-	}
-
-	return ctx
-}
-
-func (ctx *Context) FindCell(loc CellLoc) *Cell {
-	if int(loc.Row) >= len(ctx.Cells) || int(loc.Col) >= len(ctx.Cells[loc.Row]) {
-		return nil
-	}
-	return ctx.Cells[loc.Row][loc.Col]
-}
-
-func ParseCellData(value string, aCtx *Context) CellData {
-	if strings.HasPrefix(value, "=") {
-		formula := value[1:]
-		matches := reSumFormula.FindStringSubmatch(formula)
-		if matches == nil {
-			return &CellDataInvalid{Reason: "SUPPORT FORMULA"}
-		}
-
-		strStartLoc := matches[1]
-		startLoc, err := ParseCellLoc(strStartLoc)
-		if err != nil {
-			return &CellDataInvalid{Reason: "INVALID START CELL"}
-		}
-
-		strEndLoc := matches[2]
-		endLoc, err := ParseCellLoc(strEndLoc)
-		if err != nil {
-			return &CellDataInvalid{Reason: "INVALID END CELL"}
-		}
-
-		formulaData := &CellDataFormula{}
-		formulaData.Formula = formula
-		formulaData.CalCells = make(map[CellLoc]*Cell)
-		for row := startLoc.Row; row <= endLoc.Row; row++ {
-			for col := startLoc.Col; col <= endLoc.Col; col++ {
-				loc := CellLoc{Row: row, Col: col}
-				formulaData.CalCells[loc] = aCtx.FindCell(loc)
-			}
-		}
-		return formulaData
+	return &Context{
+		Sheet:  spreadsheet.NewSheet(),
+		MaxRow: maxRow,
+		MaxCol: maxCol,
 	}
-
-	num, err := strconv.ParseFloat(value, 64)
-	if err == nil {
-		return &CellDataNumber{Number: num}
-	}
-
-	return &CellDataText{Text: value}
 }
 
-func (cell *Cell) Update(value string, aCtx *Context) {
-	cellData := ParseCellData(value, aCtx)
-	cell.Data = cellData
-	cell.RawValue = value
+// Contains reports whether the cell is part of the visible grid.
+func (ctx *Context) Contains(cell spreadsheet.Cell) bool {
+	return cell.Row >= 0 && cell.Row < ctx.MaxRow && cell.Col >= 0 && cell.Col < ctx.MaxCol
 }
 
-func (ctx *Context) FindAllChangedCells(cell *Cell) map[CellLoc]*Cell {
-	changedCells := make(map[CellLoc]*Cell)
-	changedCells[cell.Loc] = cell
-
-	ctx.findAllChangedCells(cell, changedCells)
-
-	return changedCells
-}
-
-func (ctx *Context) findAllChangedCells(cell *Cell, changedCells map[CellLoc]*Cell) {
-	for row := range ctx.Cells {
-		for col := range ctx.Cells[row] {
-			changedCell := ctx.Cells[row][col]
-			if changedCell.Data.IsDependOn(cell) {
-				if _, exist := changedCells[changedCell.Loc]; !exist {
-					changedCells[changedCell.Loc] = changedCell
-					ctx.findAllChangedCells(changedCell, changedCells)
-				} else {
-					changedCell.Data = &CellDataInvalid{Reason: "RECURSIVE FORMULA"}
-				}
-			}
-		}
-	}
+// Update stores the user input in the cell and returns the cells whose
+// displayed value changed.
+func (ctx *Context) Update(cell spreadsheet.Cell, value string) []spreadsheet.Cell {
+	return ctx.Sheet.Set(cell, value)
 }
 
 func (ctx *Context) UpdateCellAtLoc(locStr string, value string) {
-	loc, err := ParseCellLoc(locStr)
-	if err != nil {
+	cell, err := spreadsheet.ParseCell(locStr)
+	if err != nil || !ctx.Contains(cell) {
 		return
 	}
-	cell := ctx.FindCell(loc)
-	if cell == nil {
-		return
-	}
-	cell.Update(value, ctx)
-}
-
-type Cell struct {
-	Loc      CellLoc
-	Data     CellData
-	RawValue string
-	Ctx      *Context
-}
-
-type CellRow int
-
-func (row CellRow) String() string {
-	return strconv.Itoa(int(row))
-}
-
-type CellCol int
-
-func reverse(s []byte) {
-	for i, j := 0, len(s)-1; i < j; i, j = i+1, j-1 {
-		s[i], s[j] = s[j], s[i]
-	}
-}
-
-func (col CellCol) String() string {
-	//  'A', ... 'Z', 'AA', 'AB', ... 'AZ', 'BA', ... 'BZ', ... 'ZZ', 'AAA', ...
-	var stringBytes []byte
-	for {
-		stringBytes = append(stringBytes, 'A'+byte(col%26))
-		col /= 26
-		if col <= 0 {
-			break
-		}
-		col -= 1
-	}
-	reverse(stringBytes)
-	return string(stringBytes)
-}
-
-type CellLoc struct {
-	Row CellRow
-	Col CellCol
+	ctx.Update(cell, value)
 }
 
-func (loc CellLoc) String() string {
-	return loc.Col.String() + loc.Row.String()
+// RawValue returns the text the user typed into the cell.
+func (ctx *Context) RawValue(cell spreadsheet.Cell) string {
+	return ctx.Sheet.Input(cell)
 }
 
-var ZERO_CELL_LOC = CellLoc{0, 0}
-
-func ParseCellLoc(str string) (CellLoc, error) {
-	loc := ZERO_CELL_LOC
-
-	if len(str) < 2 {
-		return loc, errors.New("invalid cell location: len(str) < 2")
+// Display returns the text shown in the cell.
+func (ctx *Context) Display(cell spreadsheet.Cell) string {
+	value := ctx.Sheet.Value(cell)
+	switch {
+	case value.IsError():
+		return value.Err.Error()
+	case value.Text != "":
+		return value.Text
+	case ctx.Sheet.Formula(cell) == nil && ctx.Sheet.Input(cell) == "":
+		return ""
 	}
-
-	str = strings.ToUpper(str)
-
-	runeCol := str[0]
-	if runeCol > 'Z' || runeCol < 'A' {
-		return ZERO_CELL_LOC, fmt.Errorf("invalid cell column: '%c'", runeCol)
-	}
-	loc.Col = CellCol(runeCol - 'A')
-
-	strRow := str[1:]
-	irow, err := strconv.Atoi(strRow)
-	if err != nil {
-		return ZERO_CELL_LOC, fmt.Errorf("invalid cell row: '%s'", strRow)
-	}
-	loc.Row = CellRow(irow)
-
-	return loc, nil
-}
-
-type CellData interface {
-	Eval() float64
-	Display() string
-	IsDependOn(cell *Cell) bool
-}
-
-type CellDataNumber struct {
-	Number float64
-}
-
-func (data *CellDataNumber) Eval() float64 {
-	return data.Number
-}
-
-func (data *CellDataNumber) Display() string {
-	return fmt.Sprintf("%f", data.Number)
-}
-
-func (data *CellDataNumber) IsDependOn(cell *Cell) bool {
-	return false
-}
-
-type CellDataFormula struct {
-	Formula  string
-	CalCells map[CellLoc]*Cell
-}
-
-func (data *CellDataFormula) Eval() float64 {
-	sum := 0.0
-	for _, calCell := range data.CalCells {
-		if calCell != nil {
-			sum += calCell.Data.Eval()
-		}
-	}
-	return sum
-}
-
-func (data *CellDataFormula) Display() string {
-	num := data.Eval()
-	return fmt.Sprintf("%f", num)
-}
-
-func (data *CellDataFormula) IsDependOn(cell *Cell) bool {
-	_, ok := data.CalCells[cell.Loc]
-	return ok
-}
-
-type CellDataInvalid struct {
-	Reason string
-}
-
-func (data *CellDataInvalid) Eval() float64 {
-	return math.NaN()
-}
-
-func (data *CellDataInvalid) Display() string {
-	return data.Reason
-}
-
-func (data *CellDataInvalid) IsDependOn(cell *Cell) bool {
-	return false
-}
-
-type CellDataText struct {
-	Text string
-}
-
-func (data *CellDataText) Eval() float64 {
-	return 0.0
-}
-
-func (data *CellDataText) Display() string {
-	return data.Text
-}
-
-func (data *CellDataText) IsDependOn(cell *Cell) bool {
-	return false
+	return fmt.Sprintf("%f", value.Number)
 }
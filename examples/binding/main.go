@@ -0,0 +1,42 @@
+package main
+
+import (
+	"fmt"
+
+	"github.com/george012/fltk_go"
+	"github.com/george012/fltk_go/binding"
+)
+
+func main() {
+	level := binding.NewValue(0.0)
+	text := binding.Map(level, func(v float64) string { return fmt.Sprintf("%.0f %%", v) })
+	color := binding.Map(level, func(v float64) fltk_go.Color {
+		if v > 80 {
+			return fltk_go.RED
+		}
+		return fltk_go.GREEN
+	})
+	// changes only when crossing the threshold, so the warning is shown or
+	// hidden once rather than on every slider move
+	warning := binding.Map(level, func(v float64) bool { return v > 80 })
+
+	win := fltk_go.NewWindow(320, 150, "binding example")
+	slider := fltk_go.NewSlider(10, 10, 300, 25)
+	slider.SetType(fltk_go.HOR_SLIDER)
+	slider.SetMinimum(0)
+	slider.SetMaximum(100)
+	slider.SetCallback(func() { level.Set(slider.Value()) })
+	progress := fltk_go.NewProgress(10, 45, 300, 25)
+	label := fltk_go.NewBox(fltk_go.NO_BOX, 10, 80, 300, 25)
+	alert := fltk_go.NewBox(fltk_go.FLAT_BOX, 10, 115, 300, 25, "Level is high")
+	win.End()
+
+	binder := binding.NewBinder()
+	binder.Value(progress, level)
+	binder.Color(progress, color)
+	binder.Label(label, text)
+	binder.Visible(alert, warning)
+
+	win.Show()
+	fltk_go.Run()
+}
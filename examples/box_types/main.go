@@ -0,0 +1,39 @@
+package main
+
+import (
+	"github.com/george012/fltk_go"
+)
+
+func main() {
+	card := fltk_go.NewStyledBoxType(fltk_go.BoxStyle{
+		Fill:          true,
+		Gradient:      fltk_go.BOX_GRADIENT_VERTICAL,
+		GradientColor: fltk_go.WHITE,
+		Radius:        10,
+		BorderWidth:   1,
+		BorderColor:   fltk_go.DARK3,
+	})
+	pill := fltk_go.NewStyledBoxType(fltk_go.BoxStyle{
+		Fill:   true,
+		Radius: 1000,
+	})
+	// a box type drawn from Go, for comparison
+	striped := fltk_go.NewBoxType(func(x, y, w, h int, c fltk_go.Color) {
+		for i := 0; i < h; i += 4 {
+			fltk_go.DrawRectfWithColor(x, y+i, w, 2, c)
+		}
+	})
+
+	win := fltk_go.NewWindow(360, 220, "box types example")
+	b := fltk_go.NewBox(card, 20, 20, 150, 100, "gradient card")
+	b.SetColor(fltk_go.BLUE)
+	p := fltk_go.NewButton(190, 20, 150, 40, "pill button")
+	p.SetBox(pill)
+	p.SetDownBox(pill)
+	p.SetColor(fltk_go.GREEN)
+	s := fltk_go.NewBox(striped, 20, 140, 320, 60, "drawn from Go")
+	s.SetColor(fltk_go.RED)
+	win.End()
+	win.Show()
+	fltk_go.Run()
+}
@@ -0,0 +1,62 @@
+package main
+
+import (
+	"math/rand"
+
+	"github.com/george012/fltk_go"
+)
+
+const shapeCount = 1000000
+
+func main() {
+	win := fltk_go.NewWindow(800, 600, "canvas example")
+	canvas := fltk_go.NewCanvas(0, 0, 800, 600)
+	canvas.SetNavigation(true)
+	win.Resizable(canvas)
+	win.End()
+
+	rects := make([]float64, 0, 4*shapeCount)
+	for i := 0; i < shapeCount; i++ {
+		rects = append(rects, rand.Float64()*20000, rand.Float64()*20000, 4+rand.Float64()*20, 4+rand.Float64()*20)
+	}
+	canvas.AddFilledRects(rects, fltk_go.BLUE)
+	canvas.AddText(10, 10, "wheel: zoom, right drag: pan, left drag: move a shape", fltk_go.HELVETICA, 14, fltk_go.BLACK)
+	canvas.SetView(0.05, 0, 0)
+
+	var dragged fltk_go.ShapeID
+	var lastX, lastY float64
+	canvas.SetEventHandler(func(e fltk_go.Event) bool {
+		switch e {
+		case fltk_go.PUSH:
+			if fltk_go.EventButton() != fltk_go.LeftMouse {
+				return false
+			}
+			dragged = canvas.ShapeAt(fltk_go.EventX(), fltk_go.EventY())
+			if dragged == 0 {
+				return false
+			}
+			canvas.SetShapeColor(dragged, fltk_go.RED)
+			lastX, lastY = canvas.ScreenToWorld(fltk_go.EventX(), fltk_go.EventY())
+			return true
+		case fltk_go.DRAG:
+			if dragged == 0 {
+				return false
+			}
+			x, y := canvas.ScreenToWorld(fltk_go.EventX(), fltk_go.EventY())
+			canvas.Move(dragged, x-lastX, y-lastY)
+			lastX, lastY = x, y
+			return true
+		case fltk_go.RELEASE:
+			if dragged == 0 {
+				return false
+			}
+			canvas.SetShapeColor(dragged, fltk_go.BLUE)
+			dragged = 0
+			return true
+		}
+		return false
+	})
+
+	win.Show()
+	fltk_go.Run()
+}
@@ -0,0 +1,57 @@
+package main
+
+import (
+	"fmt"
+	"math/rand"
+	"strings"
+
+	"github.com/george012/fltk_go"
+	"github.com/george012/fltk_go/linediff"
+)
+
+// config returns a large configuration file and a copy of it with a few
+// hundred scattered edits.
+func config(lines int) (string, string) {
+	var old, changed strings.Builder
+	for i := 0; i < lines; i++ {
+		line := fmt.Sprintf("service.%d.timeout = %dms\n", i, 100+i%900)
+		old.WriteString(line)
+		switch rand.Intn(2000) {
+		case 0:
+			fmt.Fprintf(&changed, "service.%d.timeout = %dms\n", i, rand.Intn(1000))
+		case 1:
+			fmt.Fprintf(&changed, "%sservice.%d.retries = %d\n", line, i, rand.Intn(5))
+		case 2:
+		default:
+			changed.WriteString(line)
+		}
+	}
+	return old.String(), changed.String()
+}
+
+func main() {
+	fltk_go.Lock()
+
+	win := fltk_go.NewWindow(1000, 600, "diff view example")
+	status := fltk_go.NewBox(fltk_go.FLAT_BOX, 5, 5, 830, 25, "comparing...")
+	next := fltk_go.NewButton(840, 5, 155, 25, "Next change @>")
+	diff := fltk_go.NewDiffView(5, 35, 990, 560)
+	win.End()
+	win.Resizable(diff)
+
+	hunk := -1
+	next.SetCallback(func() {
+		if n := len(diff.Hunks()); n > 0 {
+			hunk = (hunk + 1) % n
+			diff.ShowHunk(hunk)
+			status.SetLabel(fmt.Sprintf("change %d of %d", hunk+1, n))
+		}
+	})
+	diff.SetDoneCallback(func(hunks []linediff.Hunk) {
+		status.SetLabel(fmt.Sprintf("%d changes", len(hunks)))
+	})
+	diff.SetTexts(config(1000000))
+
+	win.Show()
+	fltk_go.Run()
+}
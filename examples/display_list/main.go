@@ -0,0 +1,56 @@
+package main
+
+import (
+	"math"
+	"math/rand"
+	"runtime"
+	"time"
+
+	"github.com/george012/fltk_go"
+)
+
+const nodeCount = 2000
+
+func main() {
+	runtime.LockOSThread()
+	// required for committing display lists from other goroutines
+	fltk_go.Lock()
+
+	win := fltk_go.NewWindow(800, 600, "display list example")
+	box := fltk_go.NewBox(fltk_go.FLAT_BOX, 0, 0, 800, 600)
+	box.SetColor(fltk_go.WHITE)
+	win.Resizable(box)
+	win.End()
+
+	presenter := fltk_go.NewDisplayListPresenter(box)
+
+	// the graph layout is computed off the UI thread, which keeps drawing
+	// the last committed frame in the meantime
+	go func() {
+		list := fltk_go.NewDisplayList()
+		xs := make([]float64, nodeCount)
+		ys := make([]float64, nodeCount)
+		for i := range xs {
+			xs[i], ys[i] = rand.Float64()*800, rand.Float64()*600
+		}
+		for t := 0.0; ; t += 0.05 {
+			list.Reset()
+			list.SetDrawColor(fltk_go.DARK3)
+			for i := 1; i < nodeCount; i++ {
+				j := (i * 7) % i
+				list.DrawLine(int(xs[i]), int(ys[i]), int(xs[j]), int(ys[j]))
+			}
+			list.SetDrawColor(fltk_go.RED)
+			for i := range xs {
+				xs[i] += math.Sin(t+float64(i)) * 0.5
+				ys[i] += math.Cos(t+float64(i)) * 0.5
+				list.DrawPie(int(xs[i])-3, int(ys[i])-3, 6, 6, 0, 360)
+			}
+			presenter.Commit(list)
+			time.Sleep(16 * time.Millisecond)
+		}
+	}()
+
+	win.Show()
+	fltk_go.Run()
+}
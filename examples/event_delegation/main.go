@@ -0,0 +1,49 @@
+package main
+
+import (
+	"fmt"
+
+	"github.com/george012/fltk_go"
+)
+
+const (
+	columns = 60
+	rows    = 40
+	size    = 14
+)
+
+func main() {
+	win := fltk_go.NewWindow(columns*size, rows*size+30, "event delegation example")
+	status := fltk_go.NewBox(fltk_go.FLAT_BOX, 0, rows*size, columns*size, 30, "Click a cell")
+	// one handler for all the cells instead of one per cell
+	grid := fltk_go.NewGroup(0, 0, columns*size, rows*size)
+	cells := make(map[fltk_go.WidgetHandle]*fltk_go.Box, columns*rows)
+	for row := 0; row < rows; row++ {
+		for col := 0; col < columns; col++ {
+			cell := fltk_go.NewBox(fltk_go.DOWN_BOX, col*size, row*size, size, size)
+			cell.SetColor(fltk_go.WHITE)
+			cells[cell.Handle()] = cell
+		}
+	}
+	grid.End()
+	grid.SetDelegatedEventHandler(func(event fltk_go.Event, target fltk_go.WidgetHandle) bool {
+		if event != fltk_go.PUSH {
+			return false
+		}
+		cell, ok := cells[target]
+		if !ok {
+			return false
+		}
+		if cell.Color() == fltk_go.WHITE {
+			cell.SetColor(fltk_go.BLUE)
+		} else {
+			cell.SetColor(fltk_go.WHITE)
+		}
+		cell.Redraw()
+		status.SetLabel(fmt.Sprintf("Cell %d, %d", (cell.X()/size)+1, (cell.Y()/size)+1))
+		return true
+	})
+	win.End()
+	win.Show()
+	fltk_go.Run()
+}
@@ -0,0 +1,36 @@
+package main
+
+import (
+	"fmt"
+	"log"
+	"os"
+
+	"github.com/george012/fltk_go"
+)
+
+// renders a few dashboards to PNG files without ever showing a window
+func main() {
+	renderer := fltk_go.NewWidgetRenderer(2)
+	for i := 1; i <= 3; i++ {
+		win := fltk_go.NewWindow(300, 200)
+		chart := fltk_go.NewChart(10, 10, 280, 180, fmt.Sprintf("report %d", i))
+		chart.SetType(fltk_go.BAR_CHART)
+		for v := 1; v <= 5; v++ {
+			chart.Add(float64(v*i), fltk_go.BLUE, fmt.Sprint(v))
+		}
+		win.End()
+
+		if err := renderer.Render(win); err != nil {
+			log.Fatal(err)
+		}
+		f, err := os.Create(fmt.Sprintf("report-%d.png", i))
+		if err != nil {
+			log.Fatal(err)
+		}
+		if err := renderer.EncodePNG(f, 6); err != nil {
+			log.Fatal(err)
+		}
+		f.Close()
+		win.Destroy()
+	}
+}
@@ -0,0 +1,64 @@
+package main
+
+import (
+	"fmt"
+	"math/rand"
+	"strings"
+
+	"github.com/george012/fltk_go"
+)
+
+var levels = []string{"DEBUG", "INFO", "INFO", "INFO", "WARN", "ERROR"}
+
+func logLines(first, n int) string {
+	var b strings.Builder
+	for i := 0; i < n; i++ {
+		fmt.Fprintf(&b, "%08d %-5s request %d took %dms\n", first+i, levels[rand.Intn(len(levels))], rand.Intn(100000), rand.Intn(500))
+	}
+	return b.String()
+}
+
+func main() {
+	const total = 1000000
+
+	buf := fltk_go.NewTextBuffer()
+	buf.SetText(logLines(0, total))
+	appended := total
+
+	win := fltk_go.NewWindow(800, 600, "grep view example")
+	filter := fltk_go.NewInput(60, 5, 735, 25, "Filter")
+	log := fltk_go.NewTextDisplay(5, 35, 790, 270)
+	log.SetBuffer(buf)
+	log.SetTextFont(fltk_go.COURIER)
+	matches := fltk_go.NewFilterView(5, 310, 790, 285)
+	matches.SetTextFont(fltk_go.COURIER)
+	matches.SetSource(buf)
+	matches.SetFilter("ERROR", true)
+	filter.SetValue("ERROR")
+	win.End()
+	win.Resizable(matches)
+
+	filter.SetCallbackCondition(fltk_go.WhenChanged)
+	filter.SetCallback(func() {
+		matches.SetFilter(filter.Value(), false)
+	})
+	matches.SetCallback(func() {
+		if i := matches.Selected(); i >= 0 {
+			log.SetInsertPosition(matches.MatchPosition(i))
+			log.ShowInsertPosition()
+		}
+	})
+
+	// the log keeps growing; only the new lines are scanned
+	var grow func()
+	grow = func() {
+		buf.Append(logLines(appended, 1000))
+		appended += 1000
+		matches.Refresh()
+		fltk_go.RepeatTimeout(0.5, grow)
+	}
+	fltk_go.AddTimeout(0.5, grow)
+
+	win.Show()
+	fltk_go.Run()
+}
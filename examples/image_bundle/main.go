@@ -0,0 +1,38 @@
+package main
+
+import (
+	"embed"
+	"fmt"
+
+	"github.com/george012/fltk_go"
+)
+
+//go:embed icons
+var icons embed.FS
+
+func main() {
+	bundle, err := fltk_go.NewImageBundle(icons)
+	if err != nil {
+		panic(err)
+	}
+	// decode everything in the background while the window is being built
+	bundle.Prewarm()
+
+	win := fltk_go.NewWindow(300, 140, "image bundle example")
+	for i, name := range bundle.Names() {
+		box := fltk_go.NewBox(fltk_go.FLAT_BOX, 20+i*90, 20, 80, 80, "")
+		img, err := bundle.Image(name)
+		if err != nil {
+			fmt.Printf("%s: %s\n", name, err)
+			continue
+		}
+		box.SetImage(img)
+		// the same image is shared by every widget using this asset
+		label := fltk_go.NewBox(fltk_go.NO_BOX, 20+i*90, 100, 80, 20, name[len("icons/"):])
+		label.SetLabelSize(11)
+	}
+	win.End()
+	win.Show()
+	fltk_go.Run()
+	bundle.Destroy()
+}
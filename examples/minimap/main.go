@@ -0,0 +1,60 @@
+package main
+
+import (
+	"fmt"
+	"strings"
+
+	"github.com/george012/fltk_go"
+)
+
+// source returns a long generated program and its styles: comments are
+// green and function declarations blue.
+func source(funcs int) (string, string) {
+	var text, styles strings.Builder
+	add := func(line string, style byte) {
+		text.WriteString(line)
+		styles.WriteString(strings.Repeat(string(style), len(line)))
+	}
+	for i := 0; i < funcs; i++ {
+		add(fmt.Sprintf("// f%d returns the sum of the first %d integers.\n", i, i), 'B')
+		add(fmt.Sprintf("func f%d() int {\n", i), 'C')
+		add("\ttotal := 0\n", 'A')
+		add(fmt.Sprintf("\tfor i := 0; i < %d; i++ {\n\t\ttotal += i\n\t}\n", i), 'A')
+		add("\treturn total\n}\n\n", 'A')
+	}
+	return text.String(), styles.String()
+}
+
+func main() {
+	win := fltk_go.NewWindow(900, 600, "minimap example")
+	editor := fltk_go.NewTextEditor(0, 0, 780, 600)
+	minimap := fltk_go.NewMinimap(780, 0, 120, 600)
+	win.End()
+	win.Resizable(editor)
+
+	text, styles := source(100000)
+	buf := fltk_go.NewTextBuffer()
+	sbuf := fltk_go.NewTextBuffer()
+	sbuf.SetText(styles)
+	buf.SetText(text)
+	// typed text is left plain
+	buf.AddModifyCallback(func(pos, inserted, deleted, _ int, _ string) {
+		if deleted > 0 {
+			sbuf.ReplaceRange(pos, pos+deleted, "")
+		}
+		if inserted > 0 {
+			sbuf.ReplaceRange(pos, pos, strings.Repeat("A", inserted))
+		}
+	})
+	editor.SetBuffer(buf)
+	editor.SetTextFont(fltk_go.COURIER)
+	editor.SetHighlightData(sbuf, []fltk_go.StyleTableEntry{
+		{Color: fltk_go.BLACK, Font: fltk_go.COURIER, Size: 14},
+		{Color: fltk_go.DARK_GREEN, Font: fltk_go.COURIER, Size: 14},
+		{Color: fltk_go.BLUE, Font: fltk_go.COURIER_BOLD, Size: 14},
+	})
+	minimap.SetDisplay(&editor.TextDisplay)
+
+	win.Show()
+	fltk_go.Run()
+}
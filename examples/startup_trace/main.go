@@ -0,0 +1,31 @@
+package main
+
+import (
+	"fmt"
+
+	"github.com/george012/fltk_go"
+)
+
+func main() {
+	endSetup := fltk_go.StartupSpan("build ui")
+	fltk_go.SetScheme("gtk+")
+	fltk_go.InitStyles()
+	// the font list is only enumerated if something asks for it
+	fltk_go.SetFontsDeferred()
+
+	win := fltk_go.NewWindow(300, 120, "startup trace example")
+	fltk_go.NewBox(fltk_go.FLAT_BOX, 0, 0, 300, 120, "Hello")
+	win.End()
+	win.Show()
+	endSetup()
+
+	fltk_go.AddTimeout(0.5, func() {
+		for _, phase := range fltk_go.StartupTrace() {
+			fmt.Printf("%-16s at %8v took %v\n", phase.Name, phase.Start, phase.Duration)
+		}
+		if t, ok := fltk_go.TimeToFirstFrame(); ok {
+			fmt.Printf("first frame after %v\n", t)
+		}
+	})
+	fltk_go.Run()
+}
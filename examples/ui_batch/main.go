@@ -0,0 +1,39 @@
+package main
+
+import (
+	"fmt"
+	"math/rand"
+	"time"
+
+	"github.com/george012/fltk_go"
+)
+
+const rows, cols = 25, 20
+
+func main() {
+	fltk_go.Lock()
+
+	win := fltk_go.NewWindow(cols*40, rows*20, "ui batch example")
+	cells := make([]*fltk_go.Box, 0, rows*cols)
+	for r := 0; r < rows; r++ {
+		for c := 0; c < cols; c++ {
+			cells = append(cells, fltk_go.NewBox(fltk_go.FLAT_BOX, c*40, r*20, 40, 20, "0"))
+		}
+	}
+	win.End()
+	win.Show()
+
+	// a background goroutine updates every cell 30 times per second; each
+	// tick costs one wakeup of the event loop instead of one per cell
+	go func() {
+		batch := fltk_go.NewUIBatch()
+		for range time.Tick(time.Second / 30) {
+			for _, cell := range cells {
+				cell, value := cell, fmt.Sprint(rand.Intn(100))
+				batch.Do(func() { cell.SetLabel(value) })
+			}
+			batch.Submit()
+		}
+	}()
+	fltk_go.Run()
+}
@@ -1,28 +1,47 @@
 package main
 
-import "github.com/george012/fltk_go"
+import (
+	"strconv"
 
-func main() {
-	win := fltk_go.NewWindow(300, 200)
-	table := fltk_go.NewTableRow(5, 5, 295, 190)
-	table.SetRowCount(2)
-	table.SetColumnCount(3)
-	table.SetBox(fltk_go.NO_BOX)
-	table.Begin()
-	for i := 0; i < 2; i++ {
-		for j := 0; j < 3; j++ {
-			x, y, w, h, err := table.FindCell(fltk_go.ContextCell, i, j)
-			if err == nil {
-				if j == 0 {
-					fltk_go.NewInput(x, y, w, h, "")
-				} else {
-					fltk_go.NewButton(x, y, w, h, "button")
-				}
-			}
-		}
+	"github.com/george012/fltk_go"
+)
+
+const rows, cols = 10000, 100
+
+// sheet stores only the cells that were edited.
+type sheet map[[2]int]string
+
+func (s sheet) CellValue(row, col int) string {
+	if value, ok := s[[2]int{row, col}]; ok {
+		return value
+	}
+	if col == 1 {
+		return "no"
 	}
+	return strconv.Itoa(row * col)
+}
+
+func (s sheet) SetCellValue(row, col int, value string) {
+	s[[2]int{row, col}] = value
+}
+
+func main() {
+	win := fltk_go.NewWindow(800, 600, "widget table example")
+	table := fltk_go.NewTableRow(5, 5, 790, 590)
+	table.SetRowCount(rows)
+	table.SetColumnCount(cols)
+	table.SetRowHeightAll(25)
+	table.SetColumnWidthAll(80)
+	table.EnableRowHeaders()
+	table.EnableColumnHeaders()
 	table.End()
 	win.End()
+	win.Resizable(table)
+
+	// a million cells edited with two widgets
+	editor := fltk_go.NewTableEditor(table, sheet{})
+	editor.SetColumnEditor(1, fltk_go.NewChoiceCellEditor("no", "yes"))
+
 	win.Show()
 	fltk_go.Run()
 }
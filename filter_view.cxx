@@ -0,0 +1,385 @@
+#include "filter_view.h"
+
+#include <algorithm>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <FL/Fl.H>
+#include <FL/Fl_Group.H>
+#include <FL/Fl_Scrollbar.H>
+#include <FL/Fl_Text_Buffer.H>
+#include <FL/fl_draw.H>
+
+#include "event_handler.h"
+
+
+// FilterView lists some lines of a text buffer, such as the ones matching a
+// search, without copying them: it only keeps the position and the line
+// number of each listed line and reads the visible ones from the buffer when
+// drawing. The lines are found in Go and appended in order.
+class FilterView : public Fl_Group {
+public:
+  FilterView(int x, int y, int w, int h, const char *label)
+    : Fl_Group(x, y, w, h, label) {
+    box(FL_DOWN_BOX);
+    color(FL_BACKGROUND2_COLOR);
+    m_scrollbar = new Fl_Scrollbar(x, y, Fl::scrollbar_size(), h);
+    m_scrollbar->linesize(1);
+    m_scrollbar->callback(scroll_cb, this);
+    end();
+    layout();
+  }
+
+  ~FilterView() {
+    if (m_source) {
+      m_source->remove_modify_callback(modified_cb, this);
+    }
+  }
+
+  void set_source(Fl_Text_Buffer *source) {
+    if (m_source) {
+      m_source->remove_modify_callback(modified_cb, this);
+    }
+    m_source = source;
+    if (m_source) {
+      m_source->add_modify_callback(modified_cb, this);
+    }
+    clear_lines();
+  }
+
+  // the lowest position modified since the last call, or -1
+  int take_invalid() {
+    const int invalid = m_invalid;
+    m_invalid = INT_MAX;
+    return invalid == INT_MAX ? -1 : invalid;
+  }
+
+  void append(const int *starts, const int *lines, int count) {
+    m_starts.insert(m_starts.end(), starts, starts + count);
+    m_lines.insert(m_lines.end(), lines, lines + count);
+    changed();
+  }
+
+  // removes the lines starting at pos or after it
+  void truncate(int pos) {
+    size_t n = m_starts.size();
+    while (n > 0 && m_starts[n - 1] >= pos) {
+      n--;
+    }
+    if (n == m_starts.size()) {
+      return;
+    }
+    m_starts.resize(n);
+    m_lines.resize(n);
+    if (m_selected >= (int)n) {
+      m_selected = -1;
+    }
+    changed();
+  }
+
+  void clear_lines() {
+    m_starts.clear();
+    m_lines.clear();
+    m_selected = -1;
+    m_invalid = INT_MAX;
+    m_scrollbar->value(0);
+    changed();
+  }
+
+  int count() const {
+    return (int)m_starts.size();
+  }
+
+  int position(int i) const {
+    return i >= 0 && i < count() ? m_starts[i] : -1;
+  }
+
+  int line(int i) const {
+    return i >= 0 && i < count() ? m_lines[i] : -1;
+  }
+
+  int selected() const {
+    return m_selected;
+  }
+
+  void select(int i) {
+    m_selected = i >= 0 && i < count() ? i : -1;
+    if (m_selected >= 0) {
+      show_line(m_selected);
+    }
+    redraw();
+  }
+
+  void text_font(Fl_Font font) {
+    m_font = font;
+    changed();
+  }
+
+  void text_size(Fl_Fontsize size) {
+    m_size = size;
+    changed();
+  }
+
+  void text_color(Fl_Color color) {
+    m_color = color;
+    redraw();
+  }
+
+  void line_numbers(bool show) {
+    m_lineNumbers = show;
+    redraw();
+  }
+
+  void resize(int x, int y, int w, int h) override {
+    Fl_Widget::resize(x, y, w, h);
+    layout();
+  }
+
+  int handle(int event) override {
+    switch (event) {
+    case FL_PUSH:
+      if (Fl::event_inside(m_scrollbar)) {
+        break;
+      }
+      if (Fl::visible_focus()) {
+        Fl::focus(this);
+      }
+      pick(m_scrollbar->value() + (Fl::event_y() - text_y()) / line_height());
+      return 1;
+    case FL_MOUSEWHEEL:
+      if (Fl::event_dy() != 0) {
+        scroll_to(m_scrollbar->value() + Fl::event_dy() * WHEEL_LINES);
+        return 1;
+      }
+      break;
+    case FL_FOCUS:
+    case FL_UNFOCUS:
+      return Fl::visible_focus() ? 1 : 0;
+    case FL_KEYBOARD: {
+      const int page = std::max(1, visible_lines() - 1);
+      switch (Fl::event_key()) {
+      case FL_Up:
+        pick(m_selected > 0 ? m_selected - 1 : 0);
+        return 1;
+      case FL_Down:
+        pick(m_selected + 1 < count() ? m_selected + 1 : count() - 1);
+        return 1;
+      case FL_Page_Up:
+        pick(std::max(0, m_selected - page));
+        return 1;
+      case FL_Page_Down:
+        pick(std::min(count() - 1, m_selected + page));
+        return 1;
+      case FL_Home:
+        pick(0);
+        return 1;
+      case FL_End:
+        pick(count() - 1);
+        return 1;
+      }
+      break;
+    }
+    }
+    return Fl_Group::handle(event);
+  }
+
+protected:
+  void draw() override {
+    draw_box();
+    const int X = text_x(), Y = text_y(), W = text_w(), H = text_h();
+    fl_push_clip(X, Y, W, H);
+    fl_font(m_font, m_size);
+    const int lh = line_height();
+    const int gutter = gutter_width();
+    const int top = m_scrollbar->value();
+    for (int i = top, y = Y; i < count() && y < Y + H; i++, y += lh) {
+      Fl_Color fg = active_r() ? m_color : fl_inactive(m_color);
+      if (i == m_selected) {
+        fl_color(selection_color());
+        fl_rectf(X, y, W, lh);
+        fg = fl_contrast(fg, selection_color());
+      }
+      const int baseline = y + lh - fl_descent() - LINE_PADDING / 2;
+      if (gutter > 0) {
+        char number[16];
+        snprintf(number, sizeof(number), "%d", m_lines[i] + 1);
+        fl_color(fl_inactive(fg));
+        fl_draw(number, X + gutter - GUTTER_PADDING - (int)fl_width(number), baseline);
+      }
+      fl_color(fg);
+      draw_text(m_starts[i], X + gutter + GUTTER_PADDING, baseline);
+    }
+    fl_pop_clip();
+    draw_child(*m_scrollbar);
+  }
+
+private:
+  enum {
+    LINE_PADDING = 2,
+    GUTTER_PADDING = 4,
+    WHEEL_LINES = 3,
+    // long lines are clipped anyway
+    MAX_DRAWN_BYTES = 1024,
+  };
+
+  static void modified_cb(int pos, int nInserted, int nDeleted, int, const char *, void *data) {
+    FilterView *v = static_cast<FilterView *>(data);
+    if ((nInserted || nDeleted) && pos < v->m_invalid) {
+      v->m_invalid = pos;
+    }
+  }
+
+  static void scroll_cb(Fl_Widget *, void *data) {
+    static_cast<FilterView *>(data)->redraw();
+  }
+
+  int text_x() const { return x() + Fl::box_dx(box()); }
+  int text_y() const { return y() + Fl::box_dy(box()); }
+  int text_w() const { return w() - Fl::box_dw(box()) - m_scrollbar->w(); }
+  int text_h() const { return h() - Fl::box_dh(box()); }
+
+  int line_height() const {
+    fl_font(m_font, m_size);
+    return fl_height() + LINE_PADDING;
+  }
+
+  int visible_lines() const {
+    return std::max(1, text_h() / line_height());
+  }
+
+  int gutter_width() const {
+    if (!m_lineNumbers || m_lines.empty()) {
+      return 0;
+    }
+    char widest[16];
+    snprintf(widest, sizeof(widest), "%d", m_lines.back() + 1);
+    for (char *p = widest; *p; p++) {
+      *p = '0';
+    }
+    return (int)fl_width(widest) + 2 * GUTTER_PADDING;
+  }
+
+  void draw_text(int start, int x, int baseline) {
+    if (!m_source || start >= m_source->length()) {
+      return;
+    }
+    int end = m_source->line_end(start);
+    if (end - start > MAX_DRAWN_BYTES) {
+      end = m_source->utf8_align(start + MAX_DRAWN_BYTES);
+    }
+    char *text = m_source->text_range(start, end);
+    fl_draw(text, end - start, x, baseline);
+    free(text);
+  }
+
+  void layout() {
+    const int sw = Fl::scrollbar_size();
+    m_scrollbar->resize(x() + w() - Fl::box_dx(box()) - sw, text_y(), sw, text_h());
+    update_scrollbar();
+  }
+
+  void update_scrollbar() {
+    const int visible = visible_lines();
+    const int top = std::max(0, std::min(m_scrollbar->value(), count() - visible));
+    m_scrollbar->value(top, visible, 0, count());
+  }
+
+  void changed() {
+    update_scrollbar();
+    redraw();
+  }
+
+  void scroll_to(int top) {
+    m_scrollbar->value(top);
+    update_scrollbar();
+    redraw();
+  }
+
+  void show_line(int i) {
+    const int top = m_scrollbar->value();
+    const int visible = visible_lines();
+    if (i < top) {
+      scroll_to(i);
+    } else if (i >= top + visible) {
+      scroll_to(i - visible + 1);
+    }
+  }
+
+  void pick(int i) {
+    if (i < 0 || i >= count()) {
+      return;
+    }
+    const bool changed = i != m_selected;
+    select(i);
+    if (changed || Fl::event_clicks()) {
+      do_callback();
+    }
+  }
+
+  Fl_Scrollbar *m_scrollbar;
+  Fl_Text_Buffer *m_source = NULL;
+  int m_invalid = INT_MAX;
+  std::vector<int> m_starts;
+  std::vector<int> m_lines;
+  int m_selected = -1;
+  Fl_Font m_font = FL_HELVETICA;
+  Fl_Fontsize m_size = FL_NORMAL_SIZE;
+  Fl_Color m_color = FL_FOREGROUND_COLOR;
+  bool m_lineNumbers = true;
+};
+
+class GFilterView : public EventHandler<FilterView> {
+public:
+  GFilterView(int x, int y, int w, int h, const char *label)
+    : EventHandler<FilterView>(x, y, w, h, label) {}
+};
+
+GFilterView *go_fltk_new_FilterView(int x, int y, int w, int h, const char *label) {
+  return new GFilterView(x, y, w, h, label);
+}
+
+void go_fltk_FilterView_set_source(GFilterView *v, Fl_Text_Buffer *source) {
+  v->set_source(source);
+}
+int go_fltk_FilterView_take_invalid(GFilterView *v) {
+  return v->take_invalid();
+}
+void go_fltk_FilterView_append(GFilterView *v, const int *starts, const int *lines, int count) {
+  v->append(starts, lines, count);
+}
+void go_fltk_FilterView_truncate(GFilterView *v, int pos) {
+  v->truncate(pos);
+}
+void go_fltk_FilterView_clear(GFilterView *v) {
+  v->clear_lines();
+}
+int go_fltk_FilterView_count(GFilterView *v) {
+  return v->count();
+}
+int go_fltk_FilterView_position(GFilterView *v, int i) {
+  return v->position(i);
+}
+int go_fltk_FilterView_line(GFilterView *v, int i) {
+  return v->line(i);
+}
+
+int go_fltk_FilterView_selected(GFilterView *v) {
+  return v->selected();
+}
+void go_fltk_FilterView_set_selected(GFilterView *v, int i) {
+  v->select(i);
+}
+void go_fltk_FilterView_set_text_font(GFilterView *v, int font) {
+  v->text_font((Fl_Font)font);
+}
+void go_fltk_FilterView_set_text_size(GFilterView *v, int size) {
+  v->text_size((Fl_Fontsize)size);
+}
+void go_fltk_FilterView_set_text_color(GFilterView *v, unsigned int color) {
+  v->text_color((Fl_Color)color);
+}
+void go_fltk_FilterView_set_line_numbers(GFilterView *v, int show) {
+  v->line_numbers(show != 0);
+}
@@ -0,0 +1,365 @@
+package fltk_go
+
+/*
+#include <stdlib.h>
+#include "filter_view.h"
+#include "text.h"
+*/
+import "C"
+import (
+	"bytes"
+	"regexp"
+	"regexp/syntax"
+	"runtime"
+	"sync"
+	"unsafe"
+)
+
+// FilterView lists the lines of a TextBuffer that match a filter, like grep.
+// The buffer is scanned in place, in parallel chunks, and the view keeps only
+// the position of each matching line, reading the visible ones from the
+// buffer as it draws. Refresh scans the text appended since the last scan,
+// so a growing log is filtered incrementally.
+//
+// The source buffer must not be destroyed while the view uses it; call
+// SetSource(nil) first.
+type FilterView struct {
+	Group
+	source *TextBuffer
+	// find returns the start of the first possible match in a chunk of
+	// lines, or -1, and match tells whether a line matches
+	find  func([]byte) int
+	match func([]byte) bool
+	// lines before scanned, the start of the first line not fully scanned
+	scanned int
+	lines   int
+}
+
+// minimal size of the chunks scanned in parallel
+const filterChunkSize = 1 << 20
+
+func NewFilterView(x, y, w, h int, text ...string) *FilterView {
+	v := &FilterView{}
+	initWidget(v, unsafe.Pointer(C.go_fltk_new_FilterView(C.int(x), C.int(y), C.int(w), C.int(h), cStringOpt(text))))
+	v.setFilter(nil, nil)
+	return v
+}
+
+func (v *FilterView) view() *C.GFilterView {
+	return (*C.GFilterView)(v.ptr())
+}
+
+// SetSource sets the buffer whose lines are filtered and scans it.
+func (v *FilterView) SetSource(buf *TextBuffer) {
+	v.source = buf
+	if buf == nil {
+		C.go_fltk_FilterView_set_source(v.view(), nil)
+		return
+	}
+	C.go_fltk_FilterView_set_source(v.view(), buf.ptr())
+	v.rescan()
+}
+
+// SetFilter shows the lines containing substr, all lines if it is empty.
+func (v *FilterView) SetFilter(substr string, matchCase bool) {
+	switch {
+	case substr == "":
+		v.setFilter(nil, nil)
+	case !matchCase:
+		v.SetRegexp(regexp.MustCompile("(?i)" + regexp.QuoteMeta(substr)))
+		return
+	default:
+		pattern := []byte(substr)
+		match := func([]byte) bool { return true }
+		if bytes.IndexByte(pattern, '\n') >= 0 {
+			match = func([]byte) bool { return false }
+		}
+		v.setFilter(func(b []byte) int { return bytes.Index(b, pattern) }, match)
+	}
+	v.rescan()
+}
+
+// SetRegexp shows the lines matching re, all lines if it is nil. Each line
+// is matched on its own, without its newline, so ^ and $ as well as \A and
+// \z match at the start and end of the line.
+func (v *FilterView) SetRegexp(re *regexp.Regexp) {
+	if re == nil {
+		v.setFilter(nil, nil)
+		v.rescan()
+		return
+	}
+	v.setFilter(regexpFilter(re))
+	v.rescan()
+}
+
+func regexpFilter(re *regexp.Regexp) (find func([]byte) int, match func([]byte) bool) {
+	if matchesTextBoundaries(re) {
+		// \A and \z only match at the ends of a chunk: every line is a
+		// candidate
+		return func([]byte) int { return 0 }, re.Match
+	}
+	// candidates are searched in chunks of lines, where ^ and $ must match
+	// at line boundaries
+	multiline, err := regexp.Compile("(?m)" + re.String())
+	if err != nil {
+		multiline = re
+	}
+	return func(b []byte) int {
+		loc := multiline.FindIndex(b)
+		if loc == nil {
+			return -1
+		}
+		return loc[0]
+	}, re.Match
+}
+
+// matchesTextBoundaries tells whether re uses \A or \z.
+func matchesTextBoundaries(re *regexp.Regexp) bool {
+	parsed, err := syntax.Parse(re.String(), syntax.Perl)
+	if err != nil {
+		return true
+	}
+	var walk func(*syntax.Regexp) bool
+	walk = func(r *syntax.Regexp) bool {
+		if r.Op == syntax.OpBeginText || r.Op == syntax.OpEndText {
+			return true
+		}
+		for _, sub := range r.Sub {
+			if walk(sub) {
+				return true
+			}
+		}
+		return false
+	}
+	return walk(parsed)
+}
+
+func (v *FilterView) setFilter(find func([]byte) int, match func([]byte) bool) {
+	if find == nil {
+		find = func([]byte) int { return 0 }
+		match = func([]byte) bool { return true }
+	}
+	v.find, v.match = find, match
+}
+
+func (v *FilterView) rescan() {
+	if v.source == nil {
+		return
+	}
+	C.go_fltk_FilterView_clear(v.view())
+	v.scanned, v.lines = 0, 0
+	v.scan()
+}
+
+// Refresh updates the view after the source changed. Text appended after the
+// last complete line that was scanned is scanned incrementally; other
+// changes rescan the whole buffer.
+func (v *FilterView) Refresh() {
+	if v.source == nil {
+		return
+	}
+	invalid := int(C.go_fltk_FilterView_take_invalid(v.view()))
+	if invalid >= 0 && invalid < v.scanned {
+		v.rescan()
+		return
+	}
+	// the last line may have been incomplete
+	C.go_fltk_FilterView_truncate(v.view(), C.int(v.scanned))
+	v.scan()
+}
+
+// filterChunk is a run of whole lines of the source starting at pos.
+type filterChunk struct {
+	data []byte
+	pos  int
+}
+
+type filterResult struct {
+	starts   []C.int
+	lines    []C.int
+	newlines int
+}
+
+func (v *FilterView) scan() {
+	buf := v.source.ptr()
+	var first, second *C.char
+	var firstLen, secondLen C.int
+	C.go_fltk_TextBuffer_segments(buf, &first, &firstLen, &second, &secondLen)
+	a := unsafe.Slice((*byte)(unsafe.Pointer(first)), int(firstLen))
+	b := unsafe.Slice((*byte)(unsafe.Pointer(second)), int(secondLen))
+	starts, lines, scanned, line := scanFilter(a, b, v.scanned, v.lines, runtime.GOMAXPROCS(0), filterChunkSize, v.find, v.match)
+	if len(starts) > 0 {
+		C.go_fltk_FilterView_append(v.view(), &starts[0], &lines[0], C.int(len(starts)))
+	}
+	v.scanned, v.lines = scanned, line
+}
+
+// scanFilter scans the text from pos on, at the start of a line preceded
+// by line lines. It returns the positions and line numbers of the matching
+// lines, and the position and number of the last line; an unterminated last
+// line is scanned again by the next refresh.
+func scanFilter(a, b []byte, pos, line, workers, minChunkSize int, find func([]byte) int, match func([]byte) bool) (starts, lines []C.int, scanned, lastLine int) {
+	if pos >= len(a)+len(b) {
+		return nil, nil, pos, line
+	}
+	chunks := splitFilterChunks(filterPieces(a, b, pos), workers, minChunkSize)
+	results := make([]filterResult, len(chunks))
+	var wg sync.WaitGroup
+	for i := range chunks {
+		wg.Add(1)
+		go func(i int) {
+			defer wg.Done()
+			results[i] = scanFilterChunk(chunks[i], find, match)
+		}(i)
+	}
+	wg.Wait()
+
+	for _, r := range results {
+		for i := range r.lines {
+			r.lines[i] += C.int(line)
+		}
+		starts = append(starts, r.starts...)
+		lines = append(lines, r.lines...)
+		line += r.newlines
+	}
+	scanned = pos
+	if nl := bytes.LastIndexByte(b, '\n'); nl >= 0 && len(a)+nl >= pos {
+		scanned = len(a) + nl + 1
+	} else if nl := bytes.LastIndexByte(a, '\n'); nl >= pos {
+		scanned = nl + 1
+	}
+	return starts, lines, scanned, line
+}
+
+// filterPieces returns the text from pos on as pieces holding whole lines.
+// The text is a and b, the two parts of the buffer around its gap; the line
+// crossing the gap is copied.
+func filterPieces(a, b []byte, pos int) []filterChunk {
+	if pos >= len(a) {
+		return []filterChunk{{b[pos-len(a):], pos}}
+	}
+	if len(b) == 0 {
+		return []filterChunk{{a[pos:], pos}}
+	}
+	cut := pos + bytes.LastIndexByte(a[pos:], '\n') + 1
+	end := bytes.IndexByte(b, '\n') + 1
+	if end == 0 {
+		end = len(b)
+	}
+	crossing := append(append([]byte(nil), a[cut:]...), b[:end]...)
+	return []filterChunk{{a[pos:cut], pos}, {crossing, cut}, {b[end:], len(a) + end}}
+}
+
+// splitFilterChunks splits the pieces at line boundaries into chunks to be
+// scanned by the given number of workers, of at least minSize bytes.
+func splitFilterChunks(pieces []filterChunk, workers, minSize int) []filterChunk {
+	total := 0
+	for _, p := range pieces {
+		total += len(p.data)
+	}
+	size := total / workers
+	if size < minSize {
+		size = minSize
+	}
+	var chunks []filterChunk
+	for _, p := range pieces {
+		for start := 0; start < len(p.data); {
+			end := start + size
+			if end >= len(p.data) {
+				end = len(p.data)
+			} else if nl := bytes.IndexByte(p.data[end:], '\n'); nl >= 0 {
+				end += nl + 1
+			} else {
+				end = len(p.data)
+			}
+			chunks = append(chunks, filterChunk{p.data[start:end], p.pos + start})
+			start = end
+		}
+	}
+	return chunks
+}
+
+// scanFilterChunk finds the matching lines of a chunk, numbering them from
+// the start of the chunk. Candidates are searched over the whole chunk, which
+// lets bytes.Index and literal regexp prefixes skip non-matching lines
+// without looking at them one by one.
+func scanFilterChunk(c filterChunk, find func([]byte) int, match func([]byte) bool) filterResult {
+	var r filterResult
+	data := c.data
+	line := 0
+	i := 0
+	for i < len(data) {
+		k := find(data[i:])
+		if k < 0 {
+			break
+		}
+		start := i + bytes.LastIndexByte(data[i:i+k], '\n') + 1
+		line += bytes.Count(data[i:start], []byte{'\n'})
+		end := bytes.IndexByte(data[start:], '\n')
+		if end < 0 {
+			end = len(data)
+		} else {
+			end += start
+		}
+		if match(data[start:end]) {
+			r.starts = append(r.starts, C.int(c.pos+start))
+			r.lines = append(r.lines, C.int(line))
+		}
+		if end == len(data) {
+			i = end
+			break
+		}
+		line++
+		i = end + 1
+	}
+	r.newlines = line + bytes.Count(data[i:], []byte{'\n'})
+	return r
+}
+
+// Count returns the number of listed lines.
+func (v *FilterView) Count() int {
+	return int(C.go_fltk_FilterView_count(v.view()))
+}
+
+// MatchLine returns the line number in the source, counted from 1, of the
+// i-th listed line.
+func (v *FilterView) MatchLine(i int) int {
+	return int(C.go_fltk_FilterView_line(v.view(), C.int(i))) + 1
+}
+
+// MatchPosition returns the position in the source of the start of the i-th
+// listed line.
+func (v *FilterView) MatchPosition(i int) int {
+	return int(C.go_fltk_FilterView_position(v.view(), C.int(i)))
+}
+
+// Selected returns the index of the selected line, or -1. The callback is
+// called when the user selects a line.
+func (v *FilterView) Selected() int {
+	return int(C.go_fltk_FilterView_selected(v.view()))
+}
+
+func (v *FilterView) SetSelected(i int) {
+	C.go_fltk_FilterView_set_selected(v.view(), C.int(i))
+}
+
+func (v *FilterView) SetTextFont(font Font) {
+	C.go_fltk_FilterView_set_text_font(v.view(), C.int(font))
+}
+
+func (v *FilterView) SetTextSize(size int) {
+	C.go_fltk_FilterView_set_text_size(v.view(), C.int(size))
+}
+
+func (v *FilterView) SetTextColor(color Color) {
+	C.go_fltk_FilterView_set_text_color(v.view(), C.uint(color))
+}
+
+// SetLineNumbers shows or hides the source line numbers.
+func (v *FilterView) SetLineNumbers(show bool) {
+	if show {
+		C.go_fltk_FilterView_set_line_numbers(v.view(), 1)
+	} else {
+		C.go_fltk_FilterView_set_line_numbers(v.view(), 0)
+	}
+}
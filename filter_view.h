@@ -0,0 +1,30 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  typedef struct GFilterView GFilterView;
+  typedef struct Fl_Text_Buffer Fl_Text_Buffer;
+
+  extern GFilterView *go_fltk_new_FilterView(int x, int y, int w, int h, const char *label);
+
+  extern void go_fltk_FilterView_set_source(GFilterView *v, Fl_Text_Buffer *source);
+  extern int go_fltk_FilterView_take_invalid(GFilterView *v);
+  extern void go_fltk_FilterView_append(GFilterView *v, const int *starts, const int *lines, int count);
+  extern void go_fltk_FilterView_truncate(GFilterView *v, int pos);
+  extern void go_fltk_FilterView_clear(GFilterView *v);
+  extern int go_fltk_FilterView_count(GFilterView *v);
+  extern int go_fltk_FilterView_position(GFilterView *v, int i);
+  extern int go_fltk_FilterView_line(GFilterView *v, int i);
+
+  extern int go_fltk_FilterView_selected(GFilterView *v);
+  extern void go_fltk_FilterView_set_selected(GFilterView *v, int i);
+  extern void go_fltk_FilterView_set_text_font(GFilterView *v, int font);
+  extern void go_fltk_FilterView_set_text_size(GFilterView *v, int size);
+  extern void go_fltk_FilterView_set_text_color(GFilterView *v, unsigned int color);
+  extern void go_fltk_FilterView_set_line_numbers(GFilterView *v, int show);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,162 @@
+package fltk_go
+
+import (
+	"bytes"
+	"reflect"
+	"regexp"
+	"strings"
+	"testing"
+)
+
+type filterMatch struct {
+	start, line int
+}
+
+// filterReference filters text line by line from pos, at line line.
+func filterReference(text string, pos, line int, match func([]byte) bool) []filterMatch {
+	var res []filterMatch
+	for pos < len(text) {
+		end := strings.IndexByte(text[pos:], '\n')
+		if end < 0 {
+			end = len(text)
+		} else {
+			end += pos
+		}
+		if match([]byte(text[pos:end])) {
+			res = append(res, filterMatch{pos, line})
+		}
+		pos, line = end+1, line+1
+	}
+	return res
+}
+
+// filterText scans text split at gap into the two parts of a text buffer.
+func filterText(text string, gap, pos, line, minChunkSize int, find func([]byte) int, match func([]byte) bool) ([]filterMatch, int, int) {
+	a, b := []byte(text[:gap]), []byte(text[gap:])
+	starts, lines, scanned, last := scanFilter(a, b, pos, line, 3, minChunkSize, find, match)
+	var res []filterMatch
+	for i := range starts {
+		res = append(res, filterMatch{int(starts[i]), int(lines[i])})
+	}
+	return res, scanned, last
+}
+
+func substringFilter(s string) (func([]byte) int, func([]byte) bool) {
+	return func(b []byte) int { return bytes.Index(b, []byte(s)) }, func([]byte) bool { return true }
+}
+
+func TestScanFilterAtEveryGap(t *testing.T) {
+	find, match := substringFilter("foo")
+	for _, text := range []string{
+		"",
+		"foo",
+		"foo\n",
+		"a\nfoo\nb\nfoofoo\n\nxfoo",
+		"\n\nfoo\n\n",
+		"bar\nbaz\nqux",
+	} {
+		want := filterReference(text, 0, 0, func(l []byte) bool { return bytes.Contains(l, []byte("foo")) })
+		wantScanned := strings.LastIndexByte(text, '\n') + 1
+		wantLines := strings.Count(text, "\n")
+		// the gap in the middle of lines and right after newlines, chunks
+		// of one line and of several
+		for gap := 0; gap <= len(text); gap++ {
+			for _, minChunkSize := range []int{1, 4, 1 << 20} {
+				got, scanned, lines := filterText(text, gap, 0, 0, minChunkSize, find, match)
+				if !reflect.DeepEqual(got, want) || scanned != wantScanned || lines != wantLines {
+					t.Errorf("%q, gap %d, chunks of %d: got %v up to %d, %d lines, want %v up to %d, %d lines",
+						text, gap, minChunkSize, got, scanned, lines, want, wantScanned, wantLines)
+				}
+			}
+		}
+	}
+}
+
+// Refresh truncates the matches from the last unterminated line and scans
+// again from its start
+func TestScanFilterAfterAppend(t *testing.T) {
+	find, match := substringFilter("foo")
+	text := "foo\nbar\nfo"
+	got, scanned, lines := filterText(text, 5, 0, 0, 1, find, match)
+	if !reflect.DeepEqual(got, []filterMatch{{0, 0}}) || scanned != 8 || lines != 2 {
+		t.Fatalf("got %v up to %d, %d lines", got, scanned, lines)
+	}
+	text += "o\nfoo\nx"
+	more, scanned, lines := filterText(text, 3, scanned, lines, 1, find, match)
+	if !reflect.DeepEqual(more, []filterMatch{{8, 2}, {12, 3}}) || scanned != 16 || lines != 4 {
+		t.Errorf("got %v up to %d, %d lines", more, scanned, lines)
+	}
+}
+
+func TestFilterPieces(t *testing.T) {
+	for _, c := range []struct {
+		a, b string
+		pos  int
+		want []filterChunk
+	}{
+		{"ab\ncd", "ef\ngh", 0, []filterChunk{{[]byte("ab\n"), 0}, {[]byte("cdef\n"), 3}, {[]byte("gh"), 8}}},
+		{"ab\n", "cd\n", 0, []filterChunk{{[]byte("ab\n"), 0}, {[]byte("cd\n"), 3}, {[]byte{}, 6}}},
+		{"ab\ncd", "ef", 3, []filterChunk{{[]byte{}, 3}, {[]byte("cdef"), 3}, {[]byte{}, 7}}},
+		{"ab", "\ncd", 3, []filterChunk{{[]byte("cd"), 3}}},
+		{"ab\n", "", 0, []filterChunk{{[]byte("ab\n"), 0}}},
+	} {
+		got := filterPieces([]byte(c.a), []byte(c.b), c.pos)
+		if len(got) != len(c.want) {
+			t.Errorf("%q %q from %d: got %d pieces, want %d", c.a, c.b, c.pos, len(got), len(c.want))
+			continue
+		}
+		for i := range got {
+			if !bytes.Equal(got[i].data, c.want[i].data) || got[i].pos != c.want[i].pos {
+				t.Errorf("%q %q from %d: piece %d is %q at %d, want %q at %d",
+					c.a, c.b, c.pos, i, got[i].data, got[i].pos, c.want[i].data, c.want[i].pos)
+			}
+		}
+	}
+}
+
+func TestSplitFilterChunks(t *testing.T) {
+	pieces := []filterChunk{{[]byte("a\nbb\nccc\n"), 0}, {[]byte("dddd\ne"), 9}}
+	chunks := splitFilterChunks(pieces, 4, 2)
+	var joined []byte
+	pos := 0
+	for _, c := range chunks {
+		if c.pos != pos {
+			t.Errorf("chunk at %d, want %d", c.pos, pos)
+		}
+		// chunks end at line ends, or at the end of their piece
+		if end := c.pos + len(c.data); c.data[len(c.data)-1] != '\n' && end != 9 && end != 15 {
+			t.Errorf("chunk %q ends inside a line", c.data)
+		}
+		joined = append(joined, c.data...)
+		pos += len(c.data)
+	}
+	if string(joined) != "a\nbb\nccc\ndddd\ne" {
+		t.Errorf("chunks join into %q", joined)
+	}
+}
+
+func TestFilterRegexpBoundaries(t *testing.T) {
+	text := "foo bar\nbar foo\nfoo\nbarfoo"
+	for _, c := range []struct {
+		pattern string
+		want    []int
+	}{
+		{"^foo", []int{0, 2}},
+		{"foo$", []int{1, 2, 3}},
+		{"^foo$", []int{2}},
+		{`\Afoo`, []int{0, 2}},
+		{`foo\z`, []int{1, 2, 3}},
+	} {
+		find, match := regexpFilter(regexp.MustCompile(c.pattern))
+		for _, minChunkSize := range []int{1, 1 << 20} {
+			got, _, _ := filterText(text, 10, 0, 0, minChunkSize, find, match)
+			var lines []int
+			for _, m := range got {
+				lines = append(lines, m.line)
+			}
+			if !reflect.DeepEqual(lines, c.want) {
+				t.Errorf("%s, chunks of %d: lines %v, want %v", c.pattern, minChunkSize, lines, c.want)
+			}
+		}
+	}
+}
@@ -1,7 +1,18 @@
 #include "fltk.h"
 
 #include <FL/Fl.H>
+#include <FL/fl_draw.H>
+#include <FL/platform.H>
 
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "box_cache.h"
+#include "startup_trace.h"
 #include "_cgo_export.h"
 
 static void lock() { Fl::lock(); }
@@ -11,7 +22,68 @@ static void unlock() {
   Fl::unlock();
 }
 
+namespace {
+
+struct StartupEvent {
+  std::string name;
+  double start, end;
+};
+
+const std::chrono::steady_clock::time_point g_load_time = std::chrono::steady_clock::now();
+std::mutex g_trace_mutex;
+std::vector<StartupEvent> g_trace;
+double g_first_frame = -1;
+
+}
+
+double startup_trace_now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - g_load_time).count();
+}
+
+void startup_trace_record(const char *name, double start, double end) {
+  std::lock_guard<std::mutex> guard(g_trace_mutex);
+  if (g_first_frame < 0) {
+    g_trace.push_back(StartupEvent{name, start, end});
+  }
+}
+
+void startup_trace_first_frame() {
+  std::lock_guard<std::mutex> guard(g_trace_mutex);
+  if (g_first_frame < 0) {
+    g_first_frame = startup_trace_now();
+  }
+}
+
+double go_fltk_startup_trace_now() {
+  return startup_trace_now();
+}
+
+void go_fltk_startup_trace_record(const char *name, double start, double end) {
+  startup_trace_record(name, start, end);
+}
+
+int go_fltk_startup_trace_count() {
+  std::lock_guard<std::mutex> guard(g_trace_mutex);
+  return (int)g_trace.size();
+}
+
+const char *go_fltk_startup_trace_event(int i, double *start, double *end) {
+  std::lock_guard<std::mutex> guard(g_trace_mutex);
+  if (i < 0 || i >= (int)g_trace.size()) {
+    return NULL;
+  }
+  *start = g_trace[i].start;
+  *end = g_trace[i].end;
+  return g_trace[i].name.c_str();
+}
+
+double go_fltk_startup_first_frame() {
+  std::lock_guard<std::mutex> guard(g_trace_mutex);
+  return g_first_frame;
+}
+
 void go_fltk_init_styles(void) {
+    StartupSpan span("init styles");
     fl_define_FL_ROUND_UP_BOX();
     fl_define_FL_SHADOW_BOX();
     fl_define_FL_ROUNDED_BOX();
@@ -29,79 +101,136 @@ void go_fltk_init_styles(void) {
     fl_define_FL_ICON_LABEL();
     fl_define_FL_IMAGE_LABEL();
     Fl::use_high_res_GL(1);
+    go_fltk_box_cache_refresh();
 }
 
-typedef void (*f_array)(int, int, int, int, unsigned int);
-
-f_array currentBoxTypeCb[57] = {&_go_drawBox0,  &_go_drawBox1,  &_go_drawBox2,  &_go_drawBox3,
-                          &_go_drawBox4,  &_go_drawBox5,  &_go_drawBox6,  &_go_drawBox7,
-                          &_go_drawBox8,  &_go_drawBox9,  &_go_drawBox10, &_go_drawBox11,
-                          &_go_drawBox12, &_go_drawBox13, &_go_drawBox14, &_go_drawBox15,
-                          &_go_drawBox16, &_go_drawBox17, &_go_drawBox18, &_go_drawBox19,
-                          &_go_drawBox20, &_go_drawBox21, &_go_drawBox22, &_go_drawBox23,
-                          &_go_drawBox24, &_go_drawBox25, &_go_drawBox26, &_go_drawBox27,
-                          &_go_drawBox28, &_go_drawBox29, &_go_drawBox30, &_go_drawBox31,
-                          &_go_drawBox32, &_go_drawBox33, &_go_drawBox34, &_go_drawBox35,
-                          &_go_drawBox36, &_go_drawBox37, &_go_drawBox38, &_go_drawBox39,
-                          &_go_drawBox40, &_go_drawBox41, &_go_drawBox42, &_go_drawBox43,
-                          &_go_drawBox44, &_go_drawBox45, &_go_drawBox46, &_go_drawBox47,
-                          &_go_drawBox48, &_go_drawBox49, &_go_drawBox50, &_go_drawBox51,
-                          &_go_drawBox52, &_go_drawBox53, &_go_drawBox54, &_go_drawBox55,
-                          &_go_drawBox56};
-
 int go_fltk_set_scheme(const char *scheme) {
-  return Fl::scheme(scheme);
+  StartupSpan span("set scheme");
+  int ret = Fl::scheme(scheme);
+  go_fltk_box_cache_refresh();
+  return ret;
 }
 
 void go_fltk_set_background_color(unsigned char r, unsigned char g, unsigned char b) {
   Fl::background(r, g, b);
+  go_fltk_box_cache_refresh();
 }
 
 void go_fltk_set_background2_color(unsigned char r, unsigned char g, unsigned char b) {
   Fl::background2(r, g, b);
-}
-
-void go_fltk_set_boxtype(int i, int x, int y, int w, int h) {
-  Fl::set_boxtype((Fl_Boxtype)i, currentBoxTypeCb[i], x, y, w, h);
+  go_fltk_box_cache_refresh();
 }
 
 void go_fltk_set_foreground_color(unsigned char r, unsigned char g, unsigned char b) {
   Fl::foreground(r, g, b);
+  go_fltk_box_cache_refresh();
 }
 
 void go_fltk_set_color(unsigned int col, unsigned char r, unsigned char g, unsigned char b) {
   Fl::set_color((Fl_Color)col, r, g, b);
+  go_fltk_box_cache_refresh();
 }
 
 void go_fltk_get_color(unsigned int col, unsigned char *r, unsigned char *g, unsigned char *b) {
   Fl::get_color((Fl_Color)col, *r, *g, *b);
 }
 
+// Font enumeration can take a noticeable part of the startup time, so
+// go_fltk_set_fonts_deferred only records the request and the fonts are
+// enumerated when the font list is first used.
+static bool g_fonts_deferred = false;
+static std::string g_fonts_pattern;
+static bool g_fonts_pattern_set = false;
+static int g_font_count = FL_FREE_FONT;
+
+static void ensure_fonts() {
+  if (!g_fonts_deferred) {
+    return;
+  }
+  g_fonts_deferred = false;
+  StartupSpan span("set fonts");
+  g_font_count = (int)Fl::set_fonts(g_fonts_pattern_set ? g_fonts_pattern.c_str() : NULL);
+}
+
 const char *go_fltk_get_font(int font) {
+  ensure_fonts();
   return Fl::get_font(font);
 }
 
 const char *go_fltk_get_font_name(int font, int *attributes) {
+  ensure_fonts();
   return Fl::get_font_name(font, attributes);
 }    
 
+// a deferred enumeration would overwrite the fonts set before it
 void go_fltk_set_font(Fl_Font font, const char* family) {
+  ensure_fonts();
   Fl::set_font(font, family);
 }
 
 void go_fltk_set_font2(Fl_Font font, Fl_Font font2) {
+  ensure_fonts();
   Fl::set_font(font, font2);
 }
 
 int go_fltk_set_fonts(const char *xstarname) {
-  return (int)Fl::set_fonts(xstarname);
+  StartupSpan span("set fonts");
+  g_fonts_deferred = false;
+  g_font_count = (int)Fl::set_fonts(xstarname);
+  return g_font_count;
 }  
 
+void go_fltk_set_fonts_deferred(const char *xstarname) {
+  g_fonts_deferred = true;
+  g_fonts_pattern_set = xstarname != NULL;
+  g_fonts_pattern = xstarname ? xstarname : "";
+}
+
+int go_fltk_font_count() {
+  ensure_fonts();
+  return g_font_count;
+}
+
+// called before the first frame is drawn, which may use fonts by index
+void go_fltk_ensure_fonts() {
+  ensure_fonts();
+}
+
+// Fills the font table from count NUL-terminated names, as returned by
+// Fl::get_font after a previous enumeration, instead of enumerating the
+// system fonts again.
+void go_fltk_set_font_table(const char *names, int count) {
+  StartupSpan span("set cached fonts");
+  // FLTK keeps the name pointers; the names are interned so that setting
+  // the table again does not copy them again
+  static std::unordered_set<std::string> interned;
+  g_fonts_deferred = false;
+  const char *name = names;
+  for (int i = 0; i < count; i++) {
+    Fl::set_font((Fl_Font)(FL_FREE_FONT + i), interned.insert(name).first->c_str());
+    name += strlen(name) + 1;
+  }
+  g_font_count = FL_FREE_FONT + count;
+}
+
+void go_fltk_font_metrics(int font, int size, int *ascent, int *descent, double *advance) {
+  static const char sample[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+  fl_open_display();
+  ensure_fonts();
+  fl_font((Fl_Font)font, (Fl_Fontsize)size);
+  *descent = fl_descent();
+  *ascent = fl_height() - *descent;
+  *advance = fl_width(sample) / (sizeof(sample) - 1);
+}
+
 unsigned go_fltk_get_colorindex(unsigned int col) {
   return Fl::get_color((Fl_Color)col);
 }
 
-int go_fltk_run() { return Fl::run(); }
+int go_fltk_run() {
+  startup_trace_record("run", startup_trace_now(), startup_trace_now());
+  return Fl::run();
+}
 int go_fltk_lock() { return Fl::lock(); }
 void go_fltk_unlock() { Fl::unlock(); }
 
@@ -123,6 +252,15 @@ int go_fltk_wait_timed(double t) {
 int go_fltk_check() {
   return Fl::check();
 }
+static void check_handler(void *data) {
+  _go_callbackHandler((uintptr_t)data);
+}
+void go_fltk_add_check(uintptr_t id) {
+  Fl::add_check(check_handler, (void*)id);
+}
+void go_fltk_remove_check(uintptr_t id) {
+  Fl::remove_check(check_handler, (void*)id);
+}
 void timeout_handler(void *data) {
   _go_timeoutHandler(uintptr_t(data));
 }
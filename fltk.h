@@ -14,7 +14,6 @@ extern "C" {
   extern int go_fltk_set_scheme(const char *scheme);
   extern void go_fltk_set_background_color(unsigned char r, unsigned char g, unsigned char b);
   extern void go_fltk_set_background2_color(unsigned char r, unsigned char g, unsigned char b);
-  extern void go_fltk_set_boxtype(int i, int x, int y, int w, int h);
   extern void go_fltk_set_foreground_color(unsigned char r, unsigned char g, unsigned char b);
   extern void go_fltk_set_color(unsigned int col, unsigned char r, unsigned char g, unsigned char b);
   extern void go_fltk_get_color(unsigned int col, unsigned char *r, unsigned char *g, unsigned char *b);
@@ -25,6 +24,17 @@ extern "C" {
   extern void go_fltk_set_font(int font, const char* family);
   extern void go_fltk_set_font2(int font, int font2);
   extern int go_fltk_set_fonts(const char* xstarname);  
+  extern void go_fltk_set_fonts_deferred(const char* xstarname);
+  extern int go_fltk_font_count();
+  extern void go_fltk_ensure_fonts();
+  extern void go_fltk_set_font_table(const char *names, int count);
+  extern void go_fltk_font_metrics(int font, int size, int *ascent, int *descent, double *advance);
+
+  extern double go_fltk_startup_trace_now();
+  extern void go_fltk_startup_trace_record(const char *name, double start, double end);
+  extern int go_fltk_startup_trace_count();
+  extern const char *go_fltk_startup_trace_event(int i, double *start, double *end);
+  extern double go_fltk_startup_first_frame();
 
   extern void go_fltk_awake_null_message();
   extern int go_fltk_awake(uintptr_t id);
@@ -32,6 +42,9 @@ extern "C" {
   extern int go_fltk_wait_timed(double t);
   extern int go_fltk_check();
 
+  extern void go_fltk_add_check(uintptr_t id);
+  extern void go_fltk_remove_check(uintptr_t id);
+
   extern void go_fltk_add_timeout(double t, uintptr_t id);
   extern void go_fltk_repeat_timeout(double t, uintptr_t id);
 
@@ -0,0 +1,262 @@
+package fltk_go
+
+/*
+#include <stdlib.h>
+#include "fltk.h"
+*/
+import "C"
+import (
+	"bufio"
+	"bytes"
+	"errors"
+	"fmt"
+	"os"
+	"path/filepath"
+	"runtime"
+	"strconv"
+	"strings"
+	"sync"
+)
+
+const fontCacheHeader = "fltk_go font cache 1"
+
+// fontMetricsSize is the size at which font metrics are measured; metrics
+// for other sizes are scaled from it.
+const fontMetricsSize = 64
+
+var ErrFontCacheStale = errors.New("font cache is stale")
+
+// FontMetrics describes a font at a given size, in pixels.
+type FontMetrics struct {
+	Ascent  int
+	Descent int
+	// Advance is the average width of letters and digits.
+	Advance float64
+}
+
+type cachedFontMetrics struct {
+	ascent, descent, advance float64
+	valid                    bool
+}
+
+// FontCache keeps the system font list and font metrics on disk, so that
+// later launches fill FLTK's font table without enumerating the system
+// fonts again. The cache is invalidated when the font configuration
+// changes, which is detected from the modification times of the fontconfig
+// caches and the system font directories.
+type FontCache struct {
+	path string
+
+	mu      sync.Mutex
+	key     string
+	names   []string
+	pretty  []string
+	attrs   []Font
+	metrics []cachedFontMetrics
+	dirty   bool
+}
+
+// DefaultFontCachePath returns the cache file location under the user's
+// cache directory.
+func DefaultFontCachePath() string {
+	dir, err := os.UserCacheDir()
+	if err != nil {
+		dir = os.TempDir()
+	}
+	return filepath.Join(dir, "fltk_go", "fonts.cache")
+}
+
+func NewFontCache(path string) *FontCache {
+	return &FontCache{path: path}
+}
+
+// SetFonts works like the package level SetFonts, but uses the cached font
+// list when it is up to date and writes the cache otherwise. The fonts are
+// set even if writing the cache fails, which the error reports.
+func (c *FontCache) SetFonts(xstarname ...string) (int, error) {
+	pattern := ""
+	if len(xstarname) > 0 {
+		pattern = xstarname[0]
+	}
+	key := fontCacheKey(pattern)
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	if err := c.load(key); err == nil {
+		c.applyFontTable()
+		return len(c.names), nil
+	}
+	count := SetFonts(xstarname...)
+	c.key = key
+	c.names = make([]string, count)
+	c.pretty = make([]string, count)
+	c.attrs = make([]Font, count)
+	c.metrics = make([]cachedFontMetrics, count)
+	for i := 0; i < count; i++ {
+		c.names[i] = GetFont(Font(i))
+		c.pretty[i], c.attrs[i] = GetFontName(Font(i))
+	}
+	c.dirty = true
+	return count, c.save()
+}
+
+func (c *FontCache) applyFontTable() {
+	if len(c.names) <= int(FREE_FONT) {
+		return
+	}
+	var buf bytes.Buffer
+	for _, name := range c.names[FREE_FONT:] {
+		buf.WriteString(name)
+		buf.WriteByte(0)
+	}
+	cnames := C.CBytes(buf.Bytes())
+	defer C.free(cnames)
+	C.go_fltk_set_font_table((*C.char)(cnames), C.int(len(c.names)-int(FREE_FONT)))
+}
+
+// FontName returns the font's name and attributes like GetFontName, from
+// the cache when possible.
+func (c *FontCache) FontName(font Font) (string, Font) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	if int(font) >= 0 && int(font) < len(c.names) {
+		return c.pretty[font], c.attrs[font]
+	}
+	return GetFontName(font)
+}
+
+// Metrics returns the font's metrics at the given size. Fonts are measured
+// once at a reference size; the measurement is kept in the cache and written
+// to disk by Save. It must be called from the main thread. Fonts that do
+// not exist have zero metrics.
+func (c *FontCache) Metrics(font Font, size int) FontMetrics {
+	if font < 0 {
+		return FontMetrics{}
+	}
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	for int(font) >= len(c.metrics) {
+		c.metrics = append(c.metrics, cachedFontMetrics{})
+	}
+	m := &c.metrics[font]
+	if !m.valid {
+		var ascent, descent C.int
+		var advance C.double
+		C.go_fltk_font_metrics(C.int(font), fontMetricsSize, &ascent, &descent, &advance)
+		*m = cachedFontMetrics{float64(ascent), float64(descent), float64(advance), true}
+		c.dirty = true
+	}
+	scale := float64(size) / fontMetricsSize
+	return FontMetrics{
+		Ascent:  int(m.ascent*scale + 0.5),
+		Descent: int(m.descent*scale + 0.5),
+		Advance: m.advance * scale,
+	}
+}
+
+// Save writes the cache to disk if it changed since it was loaded.
+func (c *FontCache) Save() error {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	return c.save()
+}
+
+func (c *FontCache) save() error {
+	if !c.dirty || c.key == "" {
+		return nil
+	}
+	var buf bytes.Buffer
+	fmt.Fprintf(&buf, "%s\t%s\n", fontCacheHeader, c.key)
+	for i, name := range c.names {
+		fmt.Fprintf(&buf, "%s\t%s\t%d", name, c.pretty[i], c.attrs[i])
+		if i < len(c.metrics) && c.metrics[i].valid {
+			m := c.metrics[i]
+			fmt.Fprintf(&buf, "\t%g\t%g\t%g", m.ascent, m.descent, m.advance)
+		}
+		buf.WriteByte('\n')
+	}
+	if err := os.MkdirAll(filepath.Dir(c.path), 0o755); err != nil {
+		return err
+	}
+	// written aside and renamed, so a concurrent launch never reads a
+	// partial file
+	tmp := c.path + ".tmp"
+	if err := os.WriteFile(tmp, buf.Bytes(), 0o644); err != nil {
+		return err
+	}
+	if err := os.Rename(tmp, c.path); err != nil {
+		return err
+	}
+	c.dirty = false
+	return nil
+}
+
+func (c *FontCache) load(key string) error {
+	data, err := os.ReadFile(c.path)
+	if err != nil {
+		return err
+	}
+	sc := bufio.NewScanner(bytes.NewReader(data))
+	if !sc.Scan() || sc.Text() != fontCacheHeader+"\t"+key {
+		return ErrFontCacheStale
+	}
+	var names, pretty []string
+	var attrs []Font
+	var metrics []cachedFontMetrics
+	for sc.Scan() {
+		fields := strings.Split(sc.Text(), "\t")
+		if len(fields) != 3 && len(fields) != 6 {
+			return ErrFontCacheStale
+		}
+		attr, err := strconv.Atoi(fields[2])
+		if err != nil {
+			return ErrFontCacheStale
+		}
+		var m cachedFontMetrics
+		if len(fields) == 6 {
+			m.valid = true
+			for j, v := range []*float64{&m.ascent, &m.descent, &m.advance} {
+				if *v, err = strconv.ParseFloat(fields[3+j], 64); err != nil {
+					return ErrFontCacheStale
+				}
+			}
+		}
+		names = append(names, fields[0])
+		pretty = append(pretty, fields[1])
+		attrs = append(attrs, Font(attr))
+		metrics = append(metrics, m)
+	}
+	if sc.Err() != nil || len(names) < int(FREE_FONT) {
+		return ErrFontCacheStale
+	}
+	c.key, c.names, c.pretty, c.attrs, c.metrics, c.dirty = key, names, pretty, attrs, metrics, false
+	return nil
+}
+
+// fontCacheKey identifies the font configuration: the enumeration pattern
+// and the newest modification time of the directories fonts and font caches
+// live in.
+func fontCacheKey(pattern string) string {
+	home, _ := os.UserHomeDir()
+	var dirs []string
+	switch runtime.GOOS {
+	case "windows":
+		dirs = []string{filepath.Join(os.Getenv("WINDIR"), "Fonts"),
+			filepath.Join(os.Getenv("LOCALAPPDATA"), "Microsoft", "Windows", "Fonts")}
+	case "darwin":
+		dirs = []string{"/System/Library/Fonts", "/Library/Fonts", filepath.Join(home, "Library", "Fonts")}
+	default:
+		cacheHome := os.Getenv("XDG_CACHE_HOME")
+		if cacheHome == "" {
+			cacheHome = filepath.Join(home, ".cache")
+		}
+		dirs = []string{"/var/cache/fontconfig", filepath.Join(cacheHome, "fontconfig"),
+			"/usr/share/fonts", "/usr/local/share/fonts", filepath.Join(home, ".local", "share", "fonts"), filepath.Join(home, ".fonts")}
+	}
+	var newest int64
+	for _, dir := range dirs {
+		if info, err := os.Stat(dir); err == nil && info.ModTime().UnixNano() > newest {
+			newest = info.ModTime().UnixNano()
+		}
+	}
+	return strconv.Quote(pattern) + " " + strconv.FormatInt(newest, 10)
+}
@@ -0,0 +1,115 @@
+package fltk_go
+
+import (
+	"errors"
+	"fmt"
+	"os"
+	"path/filepath"
+	"reflect"
+	"strings"
+	"testing"
+)
+
+func testFontCache(path string) *FontCache {
+	c := NewFontCache(path)
+	c.key = fontCacheKey("-*")
+	for i := 0; i < int(FREE_FONT)+2; i++ {
+		c.names = append(c.names, fmt.Sprintf("font%d", i))
+		c.pretty = append(c.pretty, fmt.Sprintf("Font %d", i))
+		c.attrs = append(c.attrs, Font(i%4))
+		// only measured fonts keep their metrics
+		m := cachedFontMetrics{}
+		if i%2 == 0 {
+			m = cachedFontMetrics{float64(i), 2, 7.5, true}
+		}
+		c.metrics = append(c.metrics, m)
+	}
+	c.dirty = true
+	return c
+}
+
+func TestFontCacheSaveAndLoad(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "sub", "fonts.cache")
+	saved := testFontCache(path)
+	if err := saved.Save(); err != nil {
+		t.Fatal(err)
+	}
+	if saved.dirty {
+		t.Errorf("saved cache is still dirty")
+	}
+	if _, err := os.Stat(path + ".tmp"); !os.IsNotExist(err) {
+		t.Errorf("temporary file left behind")
+	}
+
+	loaded := NewFontCache(path)
+	if err := loaded.load(saved.key); err != nil {
+		t.Fatal(err)
+	}
+	if !reflect.DeepEqual(loaded.names, saved.names) || !reflect.DeepEqual(loaded.pretty, saved.pretty) ||
+		!reflect.DeepEqual(loaded.attrs, saved.attrs) || !reflect.DeepEqual(loaded.metrics, saved.metrics) {
+		t.Errorf("loaded %+v, saved %+v", loaded, saved)
+	}
+	if err := loaded.load(fontCacheKey("other")); !errors.Is(err, ErrFontCacheStale) {
+		t.Errorf("cache of another pattern loaded: %v", err)
+	}
+}
+
+func TestFontCacheRejectsDamagedFiles(t *testing.T) {
+	dir := t.TempDir()
+	key := fontCacheKey("-*")
+	header := fontCacheHeader + "\t" + key + "\n"
+	var table strings.Builder
+	for i := 0; i < int(FREE_FONT); i++ {
+		fmt.Fprintf(&table, "font%d\tFont %d\t0\n", i, i)
+	}
+	for name, content := range map[string]string{
+		"empty":           "",
+		"other version":   "fltk_go font cache 0\t" + key + "\n" + table.String(),
+		"short table":     header + "font0\tFont 0\t0\n",
+		"bad attributes":  header + table.String() + "font\tFont\tbold\n",
+		"bad metrics":     header + table.String() + "font\tFont\t0\t1\t2\tx\n",
+		"missing metrics": header + table.String() + "font\tFont\t0\t1\n",
+	} {
+		path := filepath.Join(dir, strings.ReplaceAll(name, " ", "_"))
+		if err := os.WriteFile(path, []byte(content), 0o644); err != nil {
+			t.Fatal(err)
+		}
+		if err := NewFontCache(path).load(key); !errors.Is(err, ErrFontCacheStale) {
+			t.Errorf("%s: got %v", name, err)
+		}
+	}
+	if err := NewFontCache(filepath.Join(dir, "missing")).load(key); err == nil {
+		t.Errorf("missing file loaded")
+	}
+}
+
+func TestFontCacheSaveError(t *testing.T) {
+	dir := t.TempDir()
+	// the cache directory cannot be created over a file
+	blocker := filepath.Join(dir, "file")
+	if err := os.WriteFile(blocker, nil, 0o644); err != nil {
+		t.Fatal(err)
+	}
+	c := testFontCache(filepath.Join(blocker, "fonts.cache"))
+	if err := c.Save(); err == nil {
+		t.Errorf("no error saving under a file")
+	}
+	if !c.dirty {
+		t.Errorf("unsaved cache is not dirty")
+	}
+}
+
+func TestFontCacheKey(t *testing.T) {
+	if fontCacheKey("a") == fontCacheKey("b") {
+		t.Errorf("patterns share a key")
+	}
+	if fontCacheKey("a\tb") != fontCacheKey("a\tb") || strings.ContainsAny(fontCacheKey("a\tb\n"), "\t\n") {
+		t.Errorf("key is not stable or breaks the cache header: %q", fontCacheKey("a\tb\n"))
+	}
+}
+
+func TestFontCacheMetricsOfNegativeFont(t *testing.T) {
+	if m := NewFontCache("").Metrics(-1, 12); m != (FontMetrics{}) {
+		t.Errorf("got %+v", m)
+	}
+}
@@ -49,3 +49,11 @@ Fl_Widget* go_fltk_Group_child(Fl_Group *g, int index) {
 int go_fltk_Group_child_count(Fl_Group *g) {
   return g->children();
 }
+int go_fltk_Group_set_delegated_event_handler(Fl_Group *g, int id) {
+  WidgetWithDelegatedEventHandler* wh = dynamic_cast<WidgetWithDelegatedEventHandler*>(g);
+  if (wh == nullptr) {
+    return 0;
+  }
+  wh->set_delegated_event_handler(id);
+  return 1;
+}
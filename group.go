@@ -39,6 +39,28 @@ func (g *Group) DrawChildren() {
 	C.go_fltk_Group_draw_children((*C.Fl_Group)(g.ptr()))
 }
 
+// SetDelegatedEventHandler sets a handler receiving the events of all the
+// widgets inside the group, at any depth, along with the handle of the
+// widget receiving each one, in place of an event handler per widget. It
+// is called after the widget's own event handler, if any, and before the
+// widget handles the event itself; returning true consumes the event.
+// Handlers of nested groups are called from the innermost one out. Events
+// of the group itself do not reach it. A nil handler removes it.
+func (g *Group) SetDelegatedEventHandler(handler func(event Event, target WidgetHandle) bool) {
+	if g.delegatedEventHandlerId > 0 {
+		globalDelegatedEventHandlerMap.unregister(g.delegatedEventHandlerId)
+	}
+	g.delegatedEventHandlerId = 0
+	id := -1
+	if handler != nil {
+		g.delegatedEventHandlerId = globalDelegatedEventHandlerMap.register(handler)
+		id = g.delegatedEventHandlerId
+	}
+	if C.go_fltk_Group_set_delegated_event_handler((*C.Fl_Group)(g.ptr()), C.int(id)) == 0 {
+		panic("this group does not support delegated event handling")
+	}
+}
+
 func (g *Group) Child(index int) *widget {
 	child := C.go_fltk_Group_child((*C.Fl_Group)(g.ptr()), C.int(index))
 	if child == nil {
@@ -18,6 +18,7 @@ extern "C" {
   extern void go_fltk_Group_draw_children(Fl_Group *g);
   extern Fl_Widget* go_fltk_Group_child(Fl_Group *g, int index);
   extern int go_fltk_Group_child_count(Fl_Group* g);
+  extern int go_fltk_Group_set_delegated_event_handler(Fl_Group *g, int id);
 
 #ifdef __cplusplus
 }
@@ -9,6 +9,8 @@ import (
 	"errors"
 	"fmt"
 	goimage "image"
+	"io"
+	"os"
 	"unsafe"
 )
 
@@ -163,6 +165,20 @@ func NewRgbImageFromImage(image goimage.Image) (*RgbImage, error) {
 	return rgbImage, nil
 }
 
+// EncodePNG writes the image as PNG, compressing the pixels straight from
+// FLTK's memory. See EncodePNG for the compression level.
+func (i *RgbImage) EncodePNG(out io.Writer, level int) error {
+	data := C.go_fltk_image_data(i.ptr())
+	if data == nil || *data == nil {
+		return ErrEncodeFailed
+	}
+	w, h, d, ld := i.DataW(), i.DataH(), i.D(), i.Ld()
+	if ld == 0 {
+		ld = w * d
+	}
+	return encodePNG(out, unsafe.Pointer(*data), w, h, d, ld, level)
+}
+
 type SvgImage struct {
 	RgbImage
 }
@@ -272,21 +288,45 @@ func NewBmpImageFromData(data []uint8) (*BmpImage, error) {
 	return img, nil
 }
 
+type QoiImage struct {
+	RgbImage
+}
+
+// NewQoiImageLoad loads a QOI image, a format that decodes several times
+// faster than PNG.
+func NewQoiImageLoad(path string) (*QoiImage, error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, ErrImageFileAccess
+	}
+	return NewQoiImageFromData(data)
+}
+
+func NewQoiImageFromData(data []byte) (*QoiImage, error) {
+	if len(data) == 0 {
+		return nil, ErrImageDecodingFailed
+	}
+	img := &QoiImage{}
+	initImage(img, unsafe.Pointer(C.go_fltk_qoi_image_data((*C.uchar)(unsafe.Pointer(&data[0])), C.int(len(data)))))
+	if err := image_error(img.fail()); err != nil {
+		img.Destroy()
+		return nil, err
+	}
+	return img, nil
+}
+
 type SharedImage struct {
 	image
 }
 
-var shared_init bool
-
+// register_images registers the image formats with Fl_Shared_Image. It is
+// done on first use rather than at startup.
 func register_images() {
 	C.go_fltk_register_images()
 }
 
 func NewSharedImageLoad(path string) (*SharedImage, error) {
-	if !shared_init {
-		register_images()
-		shared_init = true
-	}
+	register_images()
 	fileStr := C.CString(path)
 	defer C.free(unsafe.Pointer(fileStr))
 	img := &SharedImage{}
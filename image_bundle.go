@@ -0,0 +1,236 @@
+package fltk_go
+
+import (
+	"bytes"
+	goimage "image"
+	"image/draw"
+	"image/jpeg"
+	"image/png"
+	"io"
+	"io/fs"
+	"path"
+	"runtime"
+	"sort"
+	"strings"
+	"sync"
+)
+
+// ImageBundle indexes a set of images by name and creates each one only
+// when it is first requested, typically from an embed.FS:
+//
+//	//go:embed icons
+//	var icons embed.FS
+//
+//	bundle, err := fltk_go.NewImageBundle(icons)
+//	img, err := bundle.Image("icons/open.png")
+//
+// Images are shared: every call for the same name returns the same image, so
+// widgets referencing one asset also share its pixels. They belong to the
+// bundle and must not be destroyed individually; use Destroy once they are
+// no longer displayed.
+type ImageBundle struct {
+	mu      sync.Mutex
+	entries map[string]*bundleEntry
+}
+
+// bundleEntry creates its image in two steps: prepare reads and, when Go
+// can, decodes the file on any goroutine, and returns build, which creates
+// the FLTK image on the UI thread.
+type bundleEntry struct {
+	prepareOnce sync.Once
+	prepare     func() func() (Image, error)
+	build       func() (Image, error)
+	once        sync.Once
+	img         Image
+	err         error
+}
+
+func (e *bundleEntry) prefetch() {
+	e.prepareOnce.Do(func() {
+		e.build = e.prepare()
+		e.prepare = nil
+	})
+}
+
+func (e *bundleEntry) load() (Image, error) {
+	e.once.Do(func() {
+		e.prefetch()
+		e.img, e.err = e.build()
+		if e.err != nil {
+			e.img = nil
+		}
+		e.build = nil
+	})
+	return e.img, e.err
+}
+
+// NewImageBundle indexes the PNG, JPEG, BMP, SVG and QOI files of fsys by
+// their path. No image is decoded yet.
+func NewImageBundle(fsys fs.FS) (*ImageBundle, error) {
+	b := &ImageBundle{entries: make(map[string]*bundleEntry)}
+	err := fs.WalkDir(fsys, ".", func(name string, d fs.DirEntry, err error) error {
+		if err != nil || d.IsDir() {
+			return err
+		}
+		decode := imageDecoderFor(path.Ext(name))
+		if decode == nil {
+			return nil
+		}
+		b.entries[name] = &bundleEntry{prepare: func() func() (Image, error) {
+			data, err := fs.ReadFile(fsys, name)
+			if err != nil {
+				return func() (Image, error) { return nil, ErrImageFileAccess }
+			}
+			return decode(data)
+		}}
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+	return b, nil
+}
+
+// NewImageBundleFromAssets indexes the images of a packed asset bundle, which
+// must stay open as long as the images are in use.
+func NewImageBundleFromAssets(assets *AssetBundle) *ImageBundle {
+	b := &ImageBundle{entries: make(map[string]*bundleEntry)}
+	for _, name := range assets.Names() {
+		name := name
+		// the pixels are mapped or decoded by FLTK, there is nothing to
+		// prepare
+		b.entries[name] = &bundleEntry{prepare: func() func() (Image, error) {
+			return func() (Image, error) { return assets.Image(name) }
+		}}
+	}
+	return b
+}
+
+// imageDecoderFor returns the function preparing the images of a file type
+// from the file's content. PNG and JPEG images are decoded by Go, then
+// copied into an RgbImage; the others are decoded by FLTK when built.
+func imageDecoderFor(ext string) func([]byte) func() (Image, error) {
+	switch strings.ToLower(ext) {
+	case ".png":
+		return func(data []byte) func() (Image, error) {
+			return decodeGoImage(data, png.Decode, func() (Image, error) { return NewPngImageFromData(data) })
+		}
+	case ".jpg", ".jpeg":
+		return func(data []byte) func() (Image, error) {
+			return decodeGoImage(data, jpeg.Decode, func() (Image, error) { return NewJpegImageFromData(data) })
+		}
+	case ".bmp":
+		return func(data []byte) func() (Image, error) {
+			return func() (Image, error) {
+				if len(data) == 0 {
+					return nil, ErrNoImage
+				}
+				return NewBmpImageFromData(data)
+			}
+		}
+	case ".qoi":
+		return func(data []byte) func() (Image, error) {
+			return func() (Image, error) { return NewQoiImageFromData(data) }
+		}
+	case ".svg":
+		return func(data []byte) func() (Image, error) {
+			return func() (Image, error) { return NewSvgImageFromString(string(data)) }
+		}
+	}
+	return nil
+}
+
+// decodeGoImage decodes data into non-premultiplied RGBA pixels, leaving
+// the images Go fails to decode to fallback, which reports FLTK's error.
+func decodeGoImage(data []byte, decode func(io.Reader) (goimage.Image, error), fallback func() (Image, error)) func() (Image, error) {
+	if len(data) == 0 {
+		return func() (Image, error) { return nil, ErrNoImage }
+	}
+	img, err := decode(bytes.NewReader(data))
+	if err != nil || img.Bounds().Empty() {
+		return fallback
+	}
+	bounds := img.Bounds()
+	nrgba, ok := img.(*goimage.NRGBA)
+	if !ok || nrgba.Stride != 4*bounds.Dx() {
+		nrgba = goimage.NewNRGBA(goimage.Rect(0, 0, bounds.Dx(), bounds.Dy()))
+		draw.Draw(nrgba, nrgba.Rect, img, bounds.Min, draw.Src)
+	}
+	return func() (Image, error) {
+		return NewRgbImage(nrgba.Pix, bounds.Dx(), bounds.Dy(), 4)
+	}
+}
+
+// Names returns the names of all images in the bundle, sorted.
+func (b *ImageBundle) Names() []string {
+	b.mu.Lock()
+	defer b.mu.Unlock()
+	names := make([]string, 0, len(b.entries))
+	for name := range b.entries {
+		names = append(names, name)
+	}
+	sort.Strings(names)
+	return names
+}
+
+func (b *ImageBundle) entry(name string) *bundleEntry {
+	b.mu.Lock()
+	defer b.mu.Unlock()
+	return b.entries[name]
+}
+
+// Image returns the named image, decoding it on first use.
+func (b *ImageBundle) Image(name string) (Image, error) {
+	e := b.entry(name)
+	if e == nil {
+		return nil, ErrAssetNotFound
+	}
+	return e.load()
+}
+
+// Prewarm prepares the named images, or all of them when no name is given,
+// so that they are ready when first shown. Files are read and, for PNG and
+// JPEG, decoded on background goroutines; the FLTK images are then created
+// on the UI thread with RunOnUI, which requires Lock to have been called,
+// or else by the first Image call for each. Image calls for an image that
+// is still being prepared wait for it.
+func (b *ImageBundle) Prewarm(names ...string) {
+	if len(names) == 0 {
+		names = b.Names()
+	}
+	work := make(chan *bundleEntry, len(names))
+	for _, name := range names {
+		if e := b.entry(name); e != nil {
+			work <- e
+		}
+	}
+	close(work)
+	workers := runtime.NumCPU()
+	if workers > len(names) {
+		workers = len(names)
+	}
+	for i := 0; i < workers; i++ {
+		go func() {
+			for e := range work {
+				e.prefetch()
+				e := e
+				RunOnUI(func() { e.load() })
+			}
+		}()
+	}
+}
+
+// Destroy destroys the images decoded so far and empties the bundle.
+func (b *ImageBundle) Destroy() {
+	b.mu.Lock()
+	entries := b.entries
+	b.entries = make(map[string]*bundleEntry)
+	b.mu.Unlock()
+	for _, e := range entries {
+		// waits for a pending decode and prevents any later one
+		e.once.Do(func() {})
+		if e.img != nil && e.img.getImage().iPtr != nil {
+			e.img.getImage().Destroy()
+		}
+	}
+}
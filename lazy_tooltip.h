@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string>
+
+#include <FL/Fl.H>
+#include <FL/Fl_Tooltip.H>
+#include <FL/Fl_Widget.H>
+
+#include "_cgo_export.h"
+
+
+// TooltipSource finds the part of a widget the mouse is over, such as a
+// table cell or a tree item, that gets its own tooltip.
+class TooltipSource {
+public:
+  // stores the item's key in a, b and item and its area in X, Y, W, H;
+  // returns false if nothing under the mouse has a tooltip
+  virtual bool tooltip_item(int &a, int &b, void *&item, int &X, int &Y, int &W, int &H) = 0;
+};
+
+// LazyTooltip shows tooltips whose text is only asked from Go when the
+// tooltip delay has expired over an item, so that no string is computed for
+// items the mouse merely passes over and mouse moves within the same item
+// never call into Go. Once the text is known, FLTK's tooltip window shows
+// it as for any other tooltip.
+class LazyTooltip {
+public:
+  LazyTooltip(Fl_Widget *widget, TooltipSource *source, uintptr_t providerId)
+    : m_widget(widget), m_source(source), m_providerId(providerId) {}
+
+  ~LazyTooltip() {
+    Fl::remove_timeout(timeout_cb, this);
+    hide();
+  }
+
+  void handle(int event) {
+    switch (event) {
+    case FL_ENTER:
+    case FL_MOVE:
+      track();
+      break;
+    case FL_LEAVE:
+    case FL_PUSH:
+    case FL_MOUSEWHEEL:
+    case FL_KEYDOWN:
+    case FL_HIDE:
+      Fl::remove_timeout(timeout_cb, this);
+      m_valid = false;
+      hide();
+      break;
+    }
+  }
+
+private:
+  void track() {
+    int a = 0, b = 0, X = 0, Y = 0, W = 0, H = 0;
+    void *item = NULL;
+    if (!m_source->tooltip_item(a, b, item, X, Y, W, H)) {
+      Fl::remove_timeout(timeout_cb, this);
+      m_valid = false;
+      hide();
+      return;
+    }
+    if (m_valid && a == m_a && b == m_b && item == m_item) {
+      return;
+    }
+    // moving on from a shown tooltip shows the next one sooner, as FLTK does
+    const bool recent = m_shown;
+    hide();
+    m_valid = true;
+    m_a = a, m_b = b, m_item = item;
+    m_X = X, m_Y = Y, m_W = W, m_H = H;
+    Fl::remove_timeout(timeout_cb, this);
+    Fl::add_timeout(recent ? Fl_Tooltip::hoverdelay() : Fl_Tooltip::delay(), timeout_cb, this);
+  }
+
+  static void timeout_cb(void *data) {
+    static_cast<LazyTooltip *>(data)->show();
+  }
+
+  void show() {
+    // in a group the mouse may be over one of its children
+    if (!m_valid || !Fl_Tooltip::enabled() || !m_widget->contains(Fl::belowmouse())) {
+      return;
+    }
+    char *text = _go_tooltipHandler(m_providerId, m_a, m_b, m_item);
+    if (!text) {
+      return;
+    }
+    m_text = text;
+    free(text);
+    // the delay has already passed, show it right away
+    const float delay = Fl_Tooltip::delay();
+    Fl_Tooltip::delay(0);
+    Fl_Tooltip::enter_area(m_widget, m_X, m_Y, m_W, m_H, m_text.c_str());
+    Fl_Tooltip::delay(delay);
+    m_shown = true;
+  }
+
+  void hide() {
+    if (m_shown && Fl_Tooltip::current() == m_widget) {
+      Fl_Tooltip::enter_area(m_widget, 0, 0, 0, 0, NULL);
+    }
+    m_shown = false;
+  }
+
+  Fl_Widget *m_widget;
+  TooltipSource *m_source;
+  uintptr_t m_providerId;
+  bool m_valid = false;
+  bool m_shown = false;
+  int m_a = 0, m_b = 0;
+  void *m_item = NULL;
+  int m_X = 0, m_Y = 0, m_W = 0, m_H = 0;
+  std::string m_text;
+};
@@ -0,0 +1,270 @@
+// Package linediff computes line level differences between two texts with
+// the histogram algorithm: regions are split recursively around the longest
+// run of matching lines anchored on the line that occurs the least often,
+// which tends to align the meaningful lines of a file rather than blank
+// lines and braces. Regions without a usable anchor fall back to Myers'
+// algorithm, and regions that differ too much for it are reported whole.
+package linediff
+
+import (
+	"context"
+)
+
+// Hunk is a run of lines replaced between the two texts: Deleted lines of a
+// starting at line A are replaced by Inserted lines of b starting at line B.
+// Lines are counted from 0.
+type Hunk struct {
+	A, B     int
+	Deleted  int
+	Inserted int
+}
+
+const (
+	// lines occurring more often than this in a region are not used as
+	// anchors; the limit keeps the anchor search linear
+	maxChainLength = 64
+	// beyond this many edits in a region without anchors, the region is
+	// reported as one hunk rather than diffed further
+	maxEditDistance = 1024
+)
+
+// Diff compares a and b line by line and calls emit with each hunk, in
+// order, as soon as it is known. It returns ctx.Err() if ctx is done before
+// the comparison is complete.
+func Diff(ctx context.Context, a, b []string, emit func(Hunk)) error {
+	ids := make(map[string]int, len(a))
+	d := &differ{
+		a:    intern(ids, a),
+		b:    intern(ids, b),
+		ctx:  ctx,
+		emit: emit,
+	}
+	d.head = make([]int32, len(ids))
+	for i := range d.head {
+		d.head[i] = -1
+	}
+	d.count = make([]int32, len(ids))
+	d.next = make([]int32, len(a))
+	d.diff(0, len(a), 0, len(b))
+	if d.err != nil {
+		return d.err
+	}
+	d.flush()
+	return nil
+}
+
+// Lines is a convenience wrapper around Diff returning all hunks.
+func Lines(a, b []string) []Hunk {
+	var hunks []Hunk
+	Diff(context.Background(), a, b, func(h Hunk) { hunks = append(hunks, h) })
+	return hunks
+}
+
+func intern(ids map[string]int, lines []string) []int {
+	res := make([]int, len(lines))
+	for i, line := range lines {
+		id, ok := ids[line]
+		if !ok {
+			id = len(ids)
+			ids[line] = id
+		}
+		res[i] = id
+	}
+	return res
+}
+
+type differ struct {
+	a, b    []int
+	ctx     context.Context
+	err     error
+	steps   int
+	emit    func(Hunk)
+	pending Hunk
+	// anchor search state, indexed by line id and by line of a
+	head, count, next []int32
+}
+
+func (d *differ) cancelled() bool {
+	if d.err == nil {
+		d.steps++
+		if d.steps%256 == 0 {
+			d.err = d.ctx.Err()
+		}
+	}
+	return d.err != nil
+}
+
+// change records that a[a0:a1] is replaced by b[b0:b1], merging it with the
+// pending hunk when they are adjacent.
+func (d *differ) change(a0, a1, b0, b1 int) {
+	p := &d.pending
+	if p.Deleted+p.Inserted > 0 && a0 == p.A+p.Deleted && b0 == p.B+p.Inserted {
+		p.Deleted += a1 - a0
+		p.Inserted += b1 - b0
+		return
+	}
+	d.flush()
+	*p = Hunk{A: a0, B: b0, Deleted: a1 - a0, Inserted: b1 - b0}
+}
+
+func (d *differ) flush() {
+	if d.pending.Deleted+d.pending.Inserted > 0 {
+		d.emit(d.pending)
+	}
+	d.pending = Hunk{}
+}
+
+// diff emits the hunks of a[alo:ahi] against b[blo:bhi] in order. The left
+// part of each split is handled recursively and the right part by the loop.
+func (d *differ) diff(alo, ahi, blo, bhi int) {
+	for !d.cancelled() {
+		for alo < ahi && blo < bhi && d.a[alo] == d.b[blo] {
+			alo++
+			blo++
+		}
+		for alo < ahi && blo < bhi && d.a[ahi-1] == d.b[bhi-1] {
+			ahi--
+			bhi--
+		}
+		if alo == ahi || blo == bhi {
+			if alo < ahi || blo < bhi {
+				d.change(alo, ahi, blo, bhi)
+			}
+			return
+		}
+		as, ae, bs, be, ok := d.anchor(alo, ahi, blo, bhi)
+		if !ok {
+			d.myers(alo, ahi, blo, bhi)
+			return
+		}
+		d.diff(alo, as, blo, bs)
+		alo, blo = ae, be
+	}
+}
+
+// anchor finds the run of matching lines to split the regions around: the
+// longest one among those containing the line with the fewest occurrences
+// in a[alo:ahi].
+func (d *differ) anchor(alo, ahi, blo, bhi int) (as, ae, bs, be int, ok bool) {
+	// the occurrences of each line of a[alo:ahi] are chained in ascending
+	// order through next, from head; the arrays are shared by all regions
+	for i := ahi - 1; i >= alo; i-- {
+		id := d.a[i]
+		if d.count[id] < maxChainLength {
+			d.next[i] = d.head[id]
+			d.head[id] = int32(i)
+		}
+		d.count[id]++
+	}
+	bestCount := int32(maxChainLength)
+	for bi := blo; bi < bhi; {
+		id := d.b[bi]
+		if count := d.count[id]; count == 0 || count > bestCount {
+			bi++
+			continue
+		}
+		next := bi + 1
+		for ai := int(d.head[id]); ai >= 0; ai = int(d.next[ai]) {
+			s, t := ai, bi
+			for s > alo && t > blo && d.a[s-1] == d.b[t-1] {
+				s--
+				t--
+			}
+			e, f := ai+1, bi+1
+			for e < ahi && f < bhi && d.a[e] == d.b[f] {
+				e++
+				f++
+			}
+			if f > next {
+				next = f
+			}
+			if d.count[id] < bestCount || e-s > ae-as {
+				as, ae, bs, be = s, e, t, f
+				bestCount = d.count[id]
+				ok = true
+			}
+		}
+		bi = next
+	}
+	for i := alo; i < ahi; i++ {
+		d.head[d.a[i]] = -1
+		d.count[d.a[i]] = 0
+	}
+	return
+}
+
+// myers diffs the regions with Myers' O((n+m)d) algorithm, giving up and
+// reporting them as one hunk past maxEditDistance edits.
+func (d *differ) myers(alo, ahi, blo, bhi int) {
+	a, b := d.a[alo:ahi], d.b[blo:bhi]
+	n, m := len(a), len(b)
+	limit := n + m
+	if limit > maxEditDistance {
+		limit = maxEditDistance
+	}
+	off := limit + 1
+	v := make([]int, 2*limit+3)
+	// trace[dd] holds v[-dd-1..dd+1] as it was before step dd
+	var trace [][]int
+	for dd := 0; dd <= limit; dd++ {
+		if d.cancelled() {
+			return
+		}
+		trace = append(trace, append([]int(nil), v[off-dd-1:off+dd+2]...))
+		for k := -dd; k <= dd; k += 2 {
+			var x int
+			if k == -dd || (k != dd && v[off+k-1] < v[off+k+1]) {
+				x = v[off+k+1]
+			} else {
+				x = v[off+k-1] + 1
+			}
+			y := x - k
+			for x < n && y < m && a[x] == b[y] {
+				x++
+				y++
+			}
+			v[off+k] = x
+			if x >= n && y >= m {
+				d.backtrack(trace, alo, blo, n, m)
+				return
+			}
+		}
+	}
+	d.change(alo, ahi, blo, bhi)
+}
+
+func (d *differ) backtrack(trace [][]int, alo, blo, x, y int) {
+	type edit struct {
+		x, y    int
+		deleted bool
+	}
+	var edits []edit
+	for dd := len(trace) - 1; dd > 0; dd-- {
+		v := trace[dd]
+		k := x - y
+		prevK := k - 1
+		if k == -dd || (k != dd && v[k-1+dd+1] < v[k+1+dd+1]) {
+			prevK = k + 1
+		}
+		prevX := v[prevK+dd+1]
+		prevY := prevX - prevK
+		for x > prevX && y > prevY {
+			x--
+			y--
+		}
+		if x == prevX {
+			edits = append(edits, edit{prevX, prevY, false})
+		} else {
+			edits = append(edits, edit{prevX, prevY, true})
+		}
+		x, y = prevX, prevY
+	}
+	for i := len(edits) - 1; i >= 0; i-- {
+		e := edits[i]
+		if e.deleted {
+			d.change(alo+e.x, alo+e.x+1, blo+e.y, blo+e.y)
+		} else {
+			d.change(alo+e.x, alo+e.x, blo+e.y, blo+e.y+1)
+		}
+	}
+}
@@ -0,0 +1,83 @@
+package linediff
+
+import (
+	"context"
+	"fmt"
+	"math/rand"
+	"reflect"
+	"testing"
+)
+
+// apply rebuilds b from a and the hunks, checking that they are ordered and
+// that the lines between them are equal.
+func apply(t *testing.T, a, b []string, hunks []Hunk) []string {
+	t.Helper()
+	var res []string
+	ai := 0
+	for _, h := range hunks {
+		if h.A < ai || h.B != len(res)+h.A-ai {
+			t.Fatalf("hunk %+v out of order", h)
+		}
+		res = append(res, a[ai:h.A]...)
+		res = append(res, b[h.B:h.B+h.Inserted]...)
+		ai = h.A + h.Deleted
+	}
+	return append(res, a[ai:]...)
+}
+
+func randomLines(r *rand.Rand, n, alphabet int) []string {
+	lines := make([]string, n)
+	for i := range lines {
+		lines[i] = fmt.Sprint(r.Intn(alphabet))
+	}
+	return lines
+}
+
+func TestLines(t *testing.T) {
+	a := []string{"a", "b", "c", "d", "e"}
+	b := []string{"a", "x", "c", "d", "f", "g"}
+	want := []Hunk{{A: 1, B: 1, Deleted: 1, Inserted: 1}, {A: 4, B: 4, Deleted: 1, Inserted: 2}}
+	if got := Lines(a, b); !reflect.DeepEqual(got, want) {
+		t.Errorf("got %+v, want %+v", got, want)
+	}
+	if got := Lines(a, a); len(got) != 0 {
+		t.Errorf("identical texts gave %+v", got)
+	}
+}
+
+func TestRandomEdits(t *testing.T) {
+	r := rand.New(rand.NewSource(1))
+	for i := 0; i < 200; i++ {
+		// small alphabets make for many repeated lines and no anchors
+		a := randomLines(r, r.Intn(300), 2+r.Intn(100))
+		b := randomLines(r, r.Intn(300), 2+r.Intn(100))
+		if r.Intn(2) == 0 {
+			b = append(append(append([]string(nil), a[:len(a)/3]...), b...), a[len(a)/2:]...)
+		}
+		hunks := Lines(a, b)
+		if got := apply(t, a, b, hunks); !reflect.DeepEqual(got, b) && !(len(got) == 0 && len(b) == 0) {
+			t.Fatalf("case %d: hunks %+v do not turn a into b", i, hunks)
+		}
+	}
+}
+
+func TestLargeDifferences(t *testing.T) {
+	// past maxEditDistance the regions are reported whole, still correctly
+	r := rand.New(rand.NewSource(2))
+	a := randomLines(r, 5000, 3)
+	b := randomLines(r, 5000, 3)
+	if got := apply(t, a, b, Lines(a, b)); !reflect.DeepEqual(got, b) {
+		t.Fatal("hunks do not turn a into b")
+	}
+}
+
+func TestCancel(t *testing.T) {
+	r := rand.New(rand.NewSource(3))
+	a := randomLines(r, 100000, 1000)
+	b := randomLines(r, 100000, 1000)
+	ctx, cancel := context.WithCancel(context.Background())
+	cancel()
+	if err := Diff(ctx, a, b, func(Hunk) {}); err != context.Canceled {
+		t.Errorf("got %v, want %v", err, context.Canceled)
+	}
+}
@@ -9,13 +9,23 @@
 
 #include "callbacks.h"
 #include "event_handler.h"
+#include "shortcut_index.h"
+
+
+static void invalidate_shortcuts(Fl_Menu_ *m) {
+  if (WidgetWithShortcutIndex *s = dynamic_cast<WidgetWithShortcutIndex*>(m)) {
+    s->invalidate_shortcuts();
+  }
+}
 
 
 int go_fltk_Menu_add(Fl_Menu_ *m, char *label, int shortcut, int callback, int flags) {
+  invalidate_shortcuts(m);
   return m->add(label, shortcut, callback_handler, (void*)(uintptr_t)callback, flags);
 }
 
 int go_fltk_Menu_add_with_icon(Fl_Menu_ *m, char *label, int shortcut, int callback, int flags, Fl_Image *img) {
+	invalidate_shortcuts(m);
 	int idx = m->add(label, shortcut, callback_handler, (void*)(uintptr_t)callback, flags);
 	Fl_Menu_Item *item = (Fl_Menu_Item*)&(m->menu()[idx]);
 	Fl_Multi_Label *ml = new Fl_Multi_Label;
@@ -29,16 +39,36 @@ int go_fltk_Menu_add_with_icon(Fl_Menu_ *m, char *label, int shortcut, int callb
 }
 
 int go_fltk_Menu_insert(Fl_Menu_ *m, int index, char *label, int shortcut, int callback, int flags) {
+  invalidate_shortcuts(m);
   return m->insert(index, label, shortcut, callback_handler, (void*)(uintptr_t)callback, flags);
 }
 
-void go_fltk_Menu_remove(Fl_Menu_ *m, int index) { m->remove(index); }
+void go_fltk_Menu_remove(Fl_Menu_ *m, int index) {
+  invalidate_shortcuts(m);
+  m->remove(index);
+}
 
-void go_fltk_Menu_clear(Fl_Menu_ *m) { m->clear(); }
+void go_fltk_Menu_clear(Fl_Menu_ *m) {
+  invalidate_shortcuts(m);
+  m->clear();
+}
 
 void go_fltk_Menu_replace(Fl_Menu_ *m, int index, const char *label) {
+  invalidate_shortcuts(m);
   m->replace(index, label);
 }
+
+int go_fltk_Menu_find_shortcut(Fl_Menu_ *m, int shortcut) {
+  if (WidgetWithShortcutIndex *s = dynamic_cast<WidgetWithShortcutIndex*>(m)) {
+    return s->find_shortcut((unsigned int)shortcut);
+  }
+  for (int i = 0; i < m->size(); i++) {
+    if (m->menu()[i].label() && m->menu()[i].shortcut() == shortcut) {
+      return i;
+    }
+  }
+  return -1;
+}
 int go_fltk_Menu_find_index(Fl_Menu_ *m, const char *label) {
   return m->find_index(label);  
 }  
@@ -56,10 +86,10 @@ const char* go_fltk_Menu_text(Fl_Menu_* m, int index) { return m->text(index); }
 int go_fltk_Menu_size(Fl_Menu_ *m) { return m->size(); }
 
 
-class GMenu_Button : public EventHandler<Fl_Menu_Button> {
+class GMenu_Button : public EventHandler<ShortcutIndex<Fl_Menu_Button>> {
 public:
   GMenu_Button(int x, int y, int w, int h, const char *label)
-    : EventHandler<Fl_Menu_Button>(x, y, w, h, label) {}
+    : EventHandler<ShortcutIndex<Fl_Menu_Button>>(x, y, w, h, label) {}
 };
 
 GMenu_Button* go_fltk_new_MenuButton(int x, int y, int w, int h, const char* text) {
@@ -72,10 +102,10 @@ void go_fltk_MenuButton_popup(Fl_Menu_Button* m) {
   m->popup();
 }
 
-class GMenu_Bar : public EventHandler<Fl_Menu_Bar> {
+class GMenu_Bar : public EventHandler<ShortcutIndex<Fl_Menu_Bar>> {
 public:
   GMenu_Bar(int x, int y, int w, int h, const char *label)
-    : EventHandler<Fl_Menu_Bar>(x, y, w, h, label) {}
+    : EventHandler<ShortcutIndex<Fl_Menu_Bar>>(x, y, w, h, label) {}
 };
 
 GMenu_Bar* go_fltk_new_MenuBar(int x, int y, int w, int h, const char* text) {
@@ -103,6 +103,12 @@ func (m *menu) FindIndex(label string) int {
 	defer C.free(unsafe.Pointer(labelStr))
 	return int(C.go_fltk_Menu_find_index((*C.Fl_Menu_)(m.ptr()), labelStr))
 }
+
+// FindShortcut returns the index of the item with the given shortcut, or -1.
+// Menu bars, menu buttons and choices look it up in their shortcut index.
+func (m *menu) FindShortcut(shortcut int) int {
+	return int(C.go_fltk_Menu_find_shortcut((*C.Fl_Menu_)(m.ptr()), C.int(shortcut)))
+}
 func (m *menu) SetValue(value int) {
 	C.go_fltk_Menu_set_value((*C.Fl_Menu_)(m.ptr()), C.int(value))
 }
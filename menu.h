@@ -17,6 +17,7 @@ extern "C" {
   extern void go_fltk_Menu_clear(Fl_Menu_ *m);
   extern void go_fltk_Menu_replace(Fl_Menu_ *m, int index, const char *label);
   extern int go_fltk_Menu_find_index(Fl_Menu_ *m, const char* label);
+  extern int go_fltk_Menu_find_shortcut(Fl_Menu_ *m, int shortcut);
   extern void go_fltk_Menu_set_value(Fl_Menu_* m, int value);
   extern int go_fltk_Menu_value(Fl_Menu_* m);
   extern const char* go_fltk_Menu_text(Fl_Menu_* m, int index);
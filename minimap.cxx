@@ -0,0 +1,415 @@
+#include "minimap.h"
+
+#include <algorithm>
+#include <limits.h>
+#include <string.h>
+#include <vector>
+
+#include <FL/Fl.H>
+#include <FL/Fl_Text_Buffer.H>
+#include <FL/Fl_Text_Display.H>
+#include <FL/Fl_Widget.H>
+#include <FL/fl_draw.H>
+
+#include "event_handler.h"
+#include "text.h"
+
+
+// TextDisplayAccess reads the state a minimap follows but that the display
+// does not expose.
+struct TextDisplayAccess : public Fl_Text_Display {
+  static int visible_lines(const Fl_Text_Display *d) {
+    int Fl_Text_Display::*lines = &TextDisplayAccess::mNVisibleLines;
+    return d->*lines;
+  }
+  static const Style_Table_Entry *style_table(const Fl_Text_Display *d, int &count) {
+    int Fl_Text_Display::*nStyles = &TextDisplayAccess::mNStyles;
+    const Style_Table_Entry *Fl_Text_Display::*table = &TextDisplayAccess::mStyleTable;
+    count = d->*nStyles;
+    return d->*table;
+  }
+};
+
+// Minimap draws an overview of the text of a display, one pixel per
+// character and one pixel row per group of lines, with the part shown by
+// the display framed. Clicking or dragging scrolls the display.
+//
+// The pixel rows in view are kept in an image and only the ones covering
+// modified lines are drawn again; the minimap keeps the start of every line
+// so that it can find them without scanning the buffer. When there are more
+// rows than fit, the minimap scrolls along with the display.
+class Minimap : public Fl_Widget {
+public:
+  Minimap(int x, int y, int w, int h, const char *label)
+    : Fl_Widget(x, y, w, h, label) {
+    box(FL_FLAT_BOX);
+    color(FL_BACKGROUND2_COLOR);
+    selection_color(FL_DARK3);
+    m_lineStarts.push_back(0);
+    Fl::add_check(check_cb, this);
+  }
+
+  ~Minimap() {
+    Fl::remove_check(check_cb, this);
+    unbind();
+    delete m_display;
+  }
+
+  // the buffers must not be destroyed while the display uses them
+  void set_display(Fl_Text_Display *display) {
+    unbind();
+    delete m_display;
+    m_display = display ? new Fl_Widget_Tracker(display) : NULL;
+    bind();
+  }
+
+  // 0 fits all the lines in the height of the minimap
+  void lines_per_row(int lines) {
+    m_fixedLinesPerRow = std::max(0, lines);
+    invalidate();
+  }
+
+  void resize(int x, int y, int w, int h) override {
+    Fl_Widget::resize(x, y, w, h);
+    invalidate();
+  }
+
+  int handle(int event) override {
+    Fl_Text_Display *d = display();
+    switch (event) {
+    case FL_PUSH: {
+      if (!d) {
+        break;
+      }
+      const int row = m_firstRow + Fl::event_y() - inner_y();
+      const int top = d->scroll_row() - 1;
+      const int visible = TextDisplayAccess::visible_lines(d);
+      if (row >= row_of(top) && row <= row_of(top + visible - 1)) {
+        m_dragOffset = row * m_linesPerRow - top;
+      } else {
+        m_dragOffset = visible / 2;
+      }
+      scroll_display(row);
+      return 1;
+    }
+    case FL_DRAG:
+      if (d) {
+        scroll_display(m_firstRow + Fl::event_y() - inner_y());
+      }
+      return 1;
+    case FL_RELEASE:
+      return 1;
+    case FL_MOUSEWHEEL:
+      if (d && Fl::event_dy() != 0) {
+        d->scroll(d->scroll_row() + Fl::event_dy() * WHEEL_LINES * m_linesPerRow, d->scroll_col());
+        return 1;
+      }
+      break;
+    }
+    return Fl_Widget::handle(event);
+  }
+
+protected:
+  void draw() override {
+    draw_box();
+    Fl_Text_Display *d = display();
+    if (!m_buffer || !d) {
+      return;
+    }
+    layout();
+    const int X = inner_x(), Y = inner_y(), W = inner_w(), H = inner_h();
+    if (W <= 0 || H <= 0) {
+      return;
+    }
+    if ((int)m_pixels.size() != W * H * 3) {
+      m_pixels.assign(W * H * 3, 0);
+      m_valid.assign(H, false);
+    }
+    for (int r = 0; r < H; r++) {
+      if (!m_valid[r]) {
+        draw_row(r);
+        m_valid[r] = true;
+      }
+    }
+    fl_draw_image(m_pixels.data(), X, Y, W, H, 3);
+
+    // frame the lines shown by the display
+    const int top = d->scroll_row() - 1;
+    const int visible = std::max(1, TextDisplayAccess::visible_lines(d));
+    const int y0 = Y + row_of(top) - m_firstRow;
+    const int y1 = Y + row_of(top + visible - 1) - m_firstRow + 1;
+    fl_push_clip(X, Y, W, H);
+    fl_color(active_r() ? selection_color() : fl_inactive(selection_color()));
+    fl_rect(X, y0, W, std::max(2, y1 - y0));
+    fl_rect(X + 1, y0 + 1, W - 2, std::max(0, y1 - y0 - 2));
+    fl_pop_clip();
+  }
+
+private:
+  enum {
+    WHEEL_LINES = 3,
+    // lines of a row that are drawn when it stands for more
+    SAMPLED_LINES = 4,
+  };
+
+  int inner_x() const { return x() + Fl::box_dx(box()); }
+  int inner_y() const { return y() + Fl::box_dy(box()); }
+  int inner_w() const { return w() - Fl::box_dw(box()); }
+  int inner_h() const { return h() - Fl::box_dh(box()); }
+
+  Fl_Text_Display *display() const {
+    return m_display && m_display->exists() ? (Fl_Text_Display *)m_display->widget() : NULL;
+  }
+
+  int lines() const {
+    return (int)m_lineStarts.size();
+  }
+
+  int rows() const {
+    return (lines() + m_linesPerRow - 1) / m_linesPerRow;
+  }
+
+  int row_of(int line) const {
+    return line / m_linesPerRow;
+  }
+
+  void bind() {
+    Fl_Text_Display *d = display();
+    m_buffer = d ? d->buffer() : NULL;
+    m_style = d ? d->style_buffer() : NULL;
+    m_top = m_visible = -1;
+    m_lineStarts.assign(1, 0);
+    if (m_buffer) {
+      m_buffer->add_modify_callback(text_modified_cb, this);
+      add_line_starts(0, m_buffer->length());
+    }
+    if (m_style) {
+      m_style->add_modify_callback(style_modified_cb, this);
+    }
+    invalidate();
+  }
+
+  void unbind() {
+    if (m_buffer) {
+      m_buffer->remove_modify_callback(text_modified_cb, this);
+    }
+    if (m_style) {
+      m_style->remove_modify_callback(style_modified_cb, this);
+    }
+    m_buffer = m_style = NULL;
+  }
+
+  // follows the display as it scrolls or gets other buffers
+  static void check_cb(void *data) {
+    Minimap *m = static_cast<Minimap *>(data);
+    Fl_Text_Display *d = m->display();
+    if (!d) {
+      if (m->m_buffer) {
+        m->unbind();
+        m->redraw();
+      }
+      return;
+    }
+    if (d->buffer() != m->m_buffer || d->style_buffer() != m->m_style) {
+      m->unbind();
+      m->bind();
+    }
+    const int top = d->scroll_row(), visible = TextDisplayAccess::visible_lines(d);
+    if (top != m->m_top || visible != m->m_visible) {
+      m->m_top = top;
+      m->m_visible = visible;
+      m->redraw();
+    }
+  }
+
+  // adds the start of the lines following the newlines in [from, to)
+  void add_line_starts(int from, int to) {
+    const char *parts[2];
+    int lengths[2];
+    go_fltk_TextBuffer_segments(m_buffer, &parts[0], &lengths[0], &parts[1], &lengths[1]);
+    std::vector<int> starts;
+    for (int part = 0, offset = 0; part < 2; offset += lengths[part], part++) {
+      const int begin = std::max(from, offset), end = std::min(to, offset + lengths[part]);
+      for (int pos = begin; pos < end;) {
+        const char *nl = (const char *)memchr(parts[part] + pos - offset, '\n', end - pos);
+        if (!nl) {
+          break;
+        }
+        pos = (int)(nl - parts[part]) + offset + 1;
+        starts.push_back(pos);
+      }
+    }
+    const std::vector<int>::iterator at = std::upper_bound(m_lineStarts.begin(), m_lineStarts.end(), from);
+    m_lineStarts.insert(at, starts.begin(), starts.end());
+  }
+
+  int line_of(int pos) const {
+    return (int)(std::upper_bound(m_lineStarts.begin(), m_lineStarts.end(), pos) - m_lineStarts.begin()) - 1;
+  }
+
+  static void text_modified_cb(int pos, int nInserted, int nDeleted, int, const char *, void *data) {
+    Minimap *m = static_cast<Minimap *>(data);
+    if (nInserted == 0 && nDeleted == 0) {
+      return;
+    }
+    const int before = m->lines();
+    const int line = m->line_of(pos);
+    // the lines starting in the deleted text are gone and the following
+    // ones moved
+    std::vector<int> &starts = m->m_lineStarts;
+    std::vector<int>::iterator first = std::upper_bound(starts.begin(), starts.end(), pos);
+    std::vector<int>::iterator last = std::upper_bound(first, starts.end(), pos + nDeleted);
+    first = starts.erase(first, last);
+    for (; first != starts.end(); ++first) {
+      *first += nInserted - nDeleted;
+    }
+    m->add_line_starts(pos, pos + nInserted);
+    if (m->lines() == before) {
+      m->invalidate_lines(line, m->line_of(pos + nInserted));
+    } else {
+      m->invalidate_lines(line, INT_MAX);
+    }
+  }
+
+  static void style_modified_cb(int pos, int nInserted, int, int nRestyled, const char *, void *data) {
+    Minimap *m = static_cast<Minimap *>(data);
+    const int end = pos + std::max(nInserted, nRestyled);
+    if (end > pos) {
+      m->invalidate_lines(m->line_of(pos), m->line_of(end));
+    }
+  }
+
+  void invalidate() {
+    m_valid.assign(m_valid.size(), false);
+    redraw();
+  }
+
+  // marks the rows covering the lines from first to last for drawing
+  void invalidate_lines(int first, int last) {
+    const int from = std::max(0, row_of(first) - m_firstRow);
+    const int to = last == INT_MAX ? (int)m_valid.size() - 1 : std::min((int)m_valid.size() - 1, row_of(last) - m_firstRow);
+    for (int r = from; r <= to; r++) {
+      m_valid[r] = false;
+    }
+    redraw();
+  }
+
+  // chooses the lines per row and the rows in view, which follow the
+  // display proportionally when they do not all fit
+  void layout() {
+    const int H = inner_h();
+    int perRow = m_fixedLinesPerRow;
+    if (perRow == 0) {
+      perRow = std::max(1, (lines() + H - 1) / std::max(1, H));
+    }
+    int first = 0;
+    if (perRow != m_linesPerRow) {
+      m_linesPerRow = perRow;
+      m_valid.assign(m_valid.size(), false);
+    }
+    Fl_Text_Display *d = display();
+    if (rows() > H && d) {
+      const int visible = TextDisplayAccess::visible_lines(d);
+      const int scrollable = std::max(1, lines() - visible);
+      first = (int)((double)(rows() - H) * std::min(d->scroll_row() - 1, scrollable) / scrollable);
+    }
+    if (first != m_firstRow) {
+      m_firstRow = first;
+      m_valid.assign(m_valid.size(), false);
+    }
+  }
+
+  void scroll_display(int row) {
+    Fl_Text_Display *d = display();
+    const int line = std::max(0, std::min(row * m_linesPerRow - m_dragOffset, lines() - 1));
+    d->scroll(line + 1, d->scroll_col());
+    check_cb(this);
+  }
+
+  // the color of a character: that of its style, or its background color
+  // when the style has one
+  Fl_Color style_color(int pos, const Fl_Text_Display::Style_Table_Entry *table, int count, Fl_Color text) const {
+    if (!m_style || !table || pos >= m_style->length()) {
+      return text;
+    }
+    const int style = (unsigned char)*m_style->address(pos) - 'A';
+    if (style < 0 || style >= count) {
+      return text;
+    }
+    const Fl_Text_Display::Style_Table_Entry &entry = table[style];
+    return entry.attr & Fl_Text_Display::ATTR_BGCOLOR ? entry.bgcolor : entry.color;
+  }
+
+  // draws a row of the image from a few of the lines it stands for
+  void draw_row(int r) {
+    const int W = inner_w();
+    uchar *pixels = &m_pixels[r * W * 3];
+    uchar bg[3];
+    Fl::get_color(color(), bg[0], bg[1], bg[2]);
+    for (int i = 0; i < W; i++) {
+      memcpy(pixels + 3 * i, bg, 3);
+    }
+    const int first = (m_firstRow + r) * m_linesPerRow;
+    const int last = std::min(first + m_linesPerRow, lines());
+    const int step = std::max(1, m_linesPerRow / SAMPLED_LINES);
+    const Fl_Color text = display()->textcolor();
+    int count = 0;
+    const Fl_Text_Display::Style_Table_Entry *table = TextDisplayAccess::style_table(display(), count);
+    const int tab = std::max(1, m_buffer->tab_distance());
+    for (int line = first; line < last; line += step) {
+      const int end = line + 1 < lines() ? m_lineStarts[line + 1] - 1 : m_buffer->length();
+      int col = 0;
+      for (int pos = m_lineStarts[line]; pos < end && col < W; pos++) {
+        const unsigned char c = (unsigned char)*m_buffer->address(pos);
+        if (c == '\t') {
+          col = (col / tab + 1) * tab;
+          continue;
+        }
+        // one column per character
+        if ((c & 0xC0) == 0x80) {
+          continue;
+        }
+        if (c != ' ' && c != '\r') {
+          uchar rgb[3];
+          Fl::get_color(fl_color_average(style_color(pos, table, count, text), color(), 0.6f), rgb[0], rgb[1], rgb[2]);
+          memcpy(pixels + 3 * col, rgb, 3);
+        }
+        col++;
+      }
+    }
+  }
+
+  Fl_Widget_Tracker *m_display = NULL;
+  Fl_Text_Buffer *m_buffer = NULL;
+  Fl_Text_Buffer *m_style = NULL;
+  // the position of the start of each line
+  std::vector<int> m_lineStarts;
+  int m_fixedLinesPerRow = 0;
+  int m_linesPerRow = 1;
+  int m_firstRow = 0;
+  // the image of the rows in view and which of its rows are up to date
+  std::vector<uchar> m_pixels;
+  std::vector<bool> m_valid;
+  // the scroll position of the display when last drawn
+  int m_top = -1;
+  int m_visible = -1;
+  // the line under the mouse relative to the top of the display
+  int m_dragOffset = 0;
+};
+
+class GMinimap : public EventHandler<Minimap> {
+public:
+  GMinimap(int x, int y, int w, int h, const char *label)
+    : EventHandler<Minimap>(x, y, w, h, label) {}
+};
+
+GMinimap *go_fltk_new_Minimap(int x, int y, int w, int h, const char *label) {
+  return new GMinimap(x, y, w, h, label);
+}
+
+void go_fltk_Minimap_set_display(GMinimap *m, Fl_Text_Display *display) {
+  m->set_display(display);
+}
+void go_fltk_Minimap_set_lines_per_row(GMinimap *m, int lines) {
+  m->lines_per_row(lines);
+}
@@ -0,0 +1,42 @@
+package fltk_go
+
+/*
+#include "minimap.h"
+*/
+import "C"
+import "unsafe"
+
+// Minimap shows an overview of the text of a TextDisplay or TextEditor, with
+// the part in view framed; clicking or dragging in it scrolls the display.
+// It is drawn in C++ from the text and style buffers of the display, which
+// it follows as they are modified, and the styles of the display color it.
+type Minimap struct {
+	widget
+}
+
+func NewMinimap(x, y, w, h int, text ...string) *Minimap {
+	m := &Minimap{}
+	initWidget(m, unsafe.Pointer(C.go_fltk_new_Minimap(C.int(x), C.int(y), C.int(w), C.int(h), cStringOpt(text))))
+	return m
+}
+
+func (m *Minimap) minimap() *C.GMinimap {
+	return (*C.GMinimap)(unsafe.Pointer(m.ptr()))
+}
+
+// SetDisplay sets the display to show, or none if it is nil. The buffers of
+// the display must not be destroyed while the minimap shows them.
+func (m *Minimap) SetDisplay(display *TextDisplay) {
+	if display == nil {
+		C.go_fltk_Minimap_set_display(m.minimap(), nil)
+		return
+	}
+	C.go_fltk_Minimap_set_display(m.minimap(), (*C.Fl_Text_Display)(unsafe.Pointer(display.ptr())))
+}
+
+// SetLinesPerRow sets how many lines each row of pixels stands for. With 0,
+// the default, all the lines fit in the minimap; otherwise it scrolls along
+// with the display when they do not.
+func (m *Minimap) SetLinesPerRow(lines int) {
+	C.go_fltk_Minimap_set_lines_per_row(m.minimap(), C.int(lines))
+}
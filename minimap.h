@@ -0,0 +1,17 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  typedef struct GMinimap GMinimap;
+  typedef struct Fl_Text_Display Fl_Text_Display;
+
+  extern GMinimap *go_fltk_new_Minimap(int x, int y, int w, int h, const char *label);
+
+  extern void go_fltk_Minimap_set_display(GMinimap *m, Fl_Text_Display *display);
+  extern void go_fltk_Minimap_set_lines_per_row(GMinimap *m, int lines);
+
+#ifdef __cplusplus
+}
+#endif
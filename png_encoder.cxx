@@ -0,0 +1,234 @@
+#include "png_encoder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
+
+
+struct GPngBuffer {
+  std::vector<unsigned char> data;
+};
+
+namespace {
+
+// Rows are compressed in independent blocks of about this many bytes, each
+// on its own thread, pigz style: every block is a raw deflate stream primed
+// with the 32k window preceding it and ended with a sync flush, so the blocks
+// concatenate into a single valid zlib stream.
+const size_t BLOCK_SIZE = 256 * 1024;
+const size_t WINDOW_SIZE = 32 * 1024;
+
+struct PngImage {
+  const unsigned char *pixels;
+  int width, height, channels, stride, level;
+
+  size_t row_bytes() const { return (size_t)width * channels; }
+  const unsigned char *row(int y) const { return y >= 0 ? pixels + (size_t)y * stride : nullptr; }
+};
+
+int paeth(int a, int b, int c) {
+  const int p = a + b - c;
+  const int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+  if (pa <= pb && pa <= pc) {
+    return a;
+  }
+  return pb <= pc ? b : c;
+}
+
+// appends the filtered row to out, choosing the filter with the smallest sum
+// of absolute differences, the heuristic recommended by the PNG specification
+void filter_row(const PngImage &img, int y, std::vector<unsigned char> &out, std::vector<unsigned char> &scratch) {
+  const size_t n = img.row_bytes();
+  const int bpp = img.channels;
+  const unsigned char *cur = img.row(y);
+  const unsigned char *prev = img.row(y - 1);
+  if (img.level == 0) {
+    out.push_back(0);
+    out.insert(out.end(), cur, cur + n);
+    return;
+  }
+  scratch.resize(5 * n);
+  long best = -1;
+  int bestFilter = 0;
+  for (int f = 0; f < 5; f++) {
+    unsigned char *dst = scratch.data() + f * n;
+    long sum = 0;
+    for (size_t i = 0; i < n; i++) {
+      const int a = i >= (size_t)bpp ? cur[i - bpp] : 0;
+      const int b = prev ? prev[i] : 0;
+      const int c = prev && i >= (size_t)bpp ? prev[i - bpp] : 0;
+      int v = cur[i];
+      switch (f) {
+      case 1: v -= a; break;
+      case 2: v -= b; break;
+      case 3: v -= (a + b) / 2; break;
+      case 4: v -= paeth(a, b, c); break;
+      }
+      dst[i] = (unsigned char)v;
+      sum += std::abs((signed char)dst[i]);
+    }
+    if (best < 0 || sum < best) {
+      best = sum;
+      bestFilter = f;
+    }
+  }
+  out.push_back((unsigned char)bestFilter);
+  const unsigned char *chosen = scratch.data() + bestFilter * n;
+  out.insert(out.end(), chosen, chosen + n);
+}
+
+struct Block {
+  int firstRow = 0, lastRow = 0;  // [firstRow, lastRow)
+  std::vector<unsigned char> compressed;
+  uLong adler = 0;
+  size_t length = 0;  // uncompressed length
+  bool ok = false;
+};
+
+void compress_block(const PngImage &img, Block &block, bool last) {
+  std::vector<unsigned char> scratch, dict, filtered;
+  // re-filter the rows preceding the block to recover its dictionary
+  const size_t filteredRow = img.row_bytes() + 1;
+  const int dictRows = (int)std::min<size_t>(block.firstRow, (WINDOW_SIZE + filteredRow - 1) / filteredRow);
+  for (int y = block.firstRow - dictRows; y < block.firstRow; y++) {
+    filter_row(img, y, dict, scratch);
+  }
+  for (int y = block.firstRow; y < block.lastRow; y++) {
+    filter_row(img, y, filtered, scratch);
+  }
+  block.length = filtered.size();
+  block.adler = adler32(adler32(0L, Z_NULL, 0), filtered.data(), (uInt)filtered.size());
+
+  z_stream zs;
+  std::memset(&zs, 0, sizeof(zs));
+  block.ok = deflateInit2(&zs, img.level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+  if (!block.ok) {
+    return;
+  }
+  if (!dict.empty()) {
+    const size_t n = std::min(dict.size(), WINDOW_SIZE);
+    deflateSetDictionary(&zs, dict.data() + dict.size() - n, (uInt)n);
+  }
+  block.compressed.resize(deflateBound(&zs, (uLong)filtered.size()) + 16);
+  zs.next_in = filtered.data();
+  zs.avail_in = (uInt)filtered.size();
+  zs.next_out = block.compressed.data();
+  zs.avail_out = (uInt)block.compressed.size();
+  const int ret = deflate(&zs, last ? Z_FINISH : Z_SYNC_FLUSH);
+  block.ok = last ? ret == Z_STREAM_END : ret == Z_OK && zs.avail_in == 0;
+  block.compressed.resize(zs.total_out);
+  deflateEnd(&zs);
+}
+
+void put32(std::vector<unsigned char> &out, uLong v) {
+  out.push_back((unsigned char)(v >> 24));
+  out.push_back((unsigned char)(v >> 16));
+  out.push_back((unsigned char)(v >> 8));
+  out.push_back((unsigned char)v);
+}
+
+void put_chunk(std::vector<unsigned char> &out, const char *type, const unsigned char *data, size_t n) {
+  put32(out, (uLong)n);
+  const size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data, data + n);
+  put32(out, crc32(0L, out.data() + start, (uInt)(n + 4)));
+}
+
+}  // namespace
+
+GPngBuffer *go_fltk_png_encode(const unsigned char *pixels, int w, int h, int channels, int stride, int level) {
+  static const unsigned char colorTypes[] = {0, 0, 4, 2, 6};
+  if (!pixels || w <= 0 || h <= 0 || channels < 1 || channels > 4) {
+    return nullptr;
+  }
+  PngImage img = {pixels, w, h, channels, stride > 0 ? stride : w * channels, std::max(0, std::min(level, 9))};
+
+  const int rowsPerBlock = (int)std::max<size_t>(1, BLOCK_SIZE / (img.row_bytes() + 1));
+  std::vector<Block> blocks;
+  for (int y = 0; y < h; y += rowsPerBlock) {
+    Block b;
+    b.firstRow = y;
+    b.lastRow = std::min(h, y + rowsPerBlock);
+    blocks.push_back(b);
+  }
+  std::atomic<size_t> next(0);
+  auto work = [&]() {
+    for (size_t i = next++; i < blocks.size(); i = next++) {
+      compress_block(img, blocks[i], i + 1 == blocks.size());
+    }
+  };
+  const size_t threads = std::min<size_t>(blocks.size(), std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::thread> pool;
+  for (size_t i = 1; i < threads; i++) {
+    pool.emplace_back(work);
+  }
+  work();
+  for (std::thread &t : pool) {
+    t.join();
+  }
+
+  // the IDAT chunk is assembled in place, so compressed blocks are copied
+  // only once on their way to the caller
+  GPngBuffer *out = new GPngBuffer();
+  std::vector<unsigned char> &png = out->data;
+  size_t total = 128;
+  for (const Block &b : blocks) {
+    total += b.compressed.size();
+  }
+  png.reserve(total);
+  static const unsigned char signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+  png.insert(png.end(), signature, signature + sizeof(signature));
+  std::vector<unsigned char> ihdr;
+  put32(ihdr, (uLong)w);
+  put32(ihdr, (uLong)h);
+  ihdr.push_back(8);  // bit depth
+  ihdr.push_back(colorTypes[channels]);
+  ihdr.push_back(0);  // deflate
+  ihdr.push_back(0);  // adaptive filtering
+  ihdr.push_back(0);  // no interlace
+  put_chunk(png, "IHDR", ihdr.data(), ihdr.size());
+
+  const size_t idat = png.size();
+  put32(png, 0);
+  png.insert(png.end(), "IDAT", "IDAT" + 4);
+  // zlib header, FLEVEL matching the compression level
+  const unsigned char flevel = img.level < 2 ? 0 : (img.level < 6 ? 1 : (img.level == 6 ? 2 : 3));
+  const unsigned char cmf = 0x78;
+  unsigned char flg = (unsigned char)(flevel << 6);
+  flg += 31 - (cmf * 256 + flg) % 31;
+  png.push_back(cmf);
+  png.push_back(flg);
+  uLong adler = adler32(0L, Z_NULL, 0);
+  for (const Block &b : blocks) {
+    if (!b.ok) {
+      delete out;
+      return nullptr;
+    }
+    png.insert(png.end(), b.compressed.begin(), b.compressed.end());
+    adler = adler32_combine(adler, b.adler, (z_off_t)b.length);
+  }
+  put32(png, adler);
+  const size_t length = png.size() - idat - 8;
+  for (int i = 0; i < 4; i++) {
+    png[idat + i] = (unsigned char)(length >> (24 - 8 * i));
+  }
+  put32(png, crc32(0L, png.data() + idat + 4, (uInt)(length + 4)));
+  put_chunk(png, "IEND", nullptr, 0);
+  return out;
+}
+
+const unsigned char *go_fltk_png_buffer_data(GPngBuffer *b) {
+  return b->data.data();
+}
+int go_fltk_png_buffer_size(GPngBuffer *b) {
+  return (int)b->data.size();
+}
+void go_fltk_png_buffer_delete(GPngBuffer *b) {
+  delete b;
+}
@@ -0,0 +1,42 @@
+package fltk_go
+
+/*
+#include "png_encoder.h"
+*/
+import "C"
+import (
+	"errors"
+	"io"
+	"unsafe"
+)
+
+var ErrEncodeFailed = errors.New("image could not be encoded")
+
+// EncodePNG writes packed 8 bit pixels as PNG. channels is 1 for gray, 2 for
+// gray with alpha, 3 for RGB and 4 for RGBA; level is the zlib compression
+// level from 0 to 9.
+//
+// The image is compressed in blocks on all CPU cores. EncodePNG does not use
+// FLTK and may be called from any goroutine.
+func EncodePNG(out io.Writer, pix []byte, width, height, channels, level int) error {
+	if width <= 0 || height <= 0 || channels < 1 || channels > 4 || len(pix) < width*height*channels {
+		return ErrEncodeFailed
+	}
+	return encodePNG(out, unsafe.Pointer(&pix[0]), width, height, channels, width*channels, level)
+}
+
+func encodePNG(out io.Writer, pixels unsafe.Pointer, width, height, channels, stride, level int) error {
+	return writePNGBuffer(out, C.go_fltk_png_encode((*C.uchar)(pixels), C.int(width), C.int(height), C.int(channels), C.int(stride), C.int(level)))
+}
+
+// writePNGBuffer writes and frees an encoded image. The writer is handed the
+// C memory directly instead of a copy.
+func writePNGBuffer(out io.Writer, buf *C.GPngBuffer) error {
+	if buf == nil {
+		return ErrEncodeFailed
+	}
+	defer C.go_fltk_png_buffer_delete(buf)
+	data := unsafe.Slice((*byte)(unsafe.Pointer(C.go_fltk_png_buffer_data(buf))), int(C.go_fltk_png_buffer_size(buf)))
+	_, err := out.Write(data)
+	return err
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  typedef struct GPngBuffer GPngBuffer;
+
+  extern GPngBuffer *go_fltk_png_encode(const unsigned char *pixels, int w, int h, int channels, int stride, int level);
+  extern const unsigned char *go_fltk_png_buffer_data(GPngBuffer *b);
+  extern int go_fltk_png_buffer_size(GPngBuffer *b);
+  extern void go_fltk_png_buffer_delete(GPngBuffer *b);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,13 +2,14 @@
 
 #include <FL/Fl_Roller.H>
 
+#include "callback_coalescing.h"
 #include "event_handler.h"
 
 
-class GRoller : public EventHandler<Fl_Roller> {
+class GRoller : public EventHandler<CallbackCoalescing<Fl_Roller>> {
 public:
   GRoller(int x, int y, int w, int h, const char* label)
-    : EventHandler<Fl_Roller>(x, y, w, h, label) {}
+    : EventHandler<CallbackCoalescing<Fl_Roller>>(x, y, w, h, label) {}
 };
 
 
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+struct RTreeBox {
+  float x0, y0, x1, y1;
+
+  bool intersects(const RTreeBox &o) const {
+    return x0 <= o.x1 && o.x0 <= x1 && y0 <= o.y1 && o.y0 <= y1;
+  }
+  void extend(const RTreeBox &o) {
+    x0 = std::min(x0, o.x0);
+    y0 = std::min(y0, o.y0);
+    x1 = std::max(x1, o.x1);
+    y1 = std::max(y1, o.y1);
+  }
+};
+
+// RTree is a static R-tree bulk loaded with the Sort-Tile-Recursive algorithm.
+// Rebuilding it is O(n log n) and queries are O(log n + k), so it suits
+// indexes that are queried far more often than they change; callers keep
+// recently modified items aside and rebuild once enough have accumulated.
+class RTree {
+public:
+  struct Entry {
+    RTreeBox box;
+    int id;
+  };
+
+  void build(std::vector<Entry> entries) {
+    m_entries.swap(entries);
+    m_nodes.clear();
+    m_root = -1;
+    if (m_entries.empty()) {
+      return;
+    }
+    str_sort(m_entries);
+    std::vector<Node> level;
+    for (size_t i = 0; i < m_entries.size(); i += NODE_SIZE) {
+      Node node;
+      node.first = (int)i;
+      node.count = (int)std::min<size_t>(NODE_SIZE, m_entries.size() - i);
+      node.leaf = true;
+      node.box = m_entries[i].box;
+      for (int j = 1; j < node.count; j++) {
+        node.box.extend(m_entries[i + j].box);
+      }
+      level.push_back(node);
+    }
+    while (level.size() > 1) {
+      str_sort(level);
+      const size_t base = m_nodes.size();
+      m_nodes.insert(m_nodes.end(), level.begin(), level.end());
+      std::vector<Node> parents;
+      for (size_t i = 0; i < level.size(); i += NODE_SIZE) {
+        Node node;
+        node.first = (int)(base + i);
+        node.count = (int)std::min<size_t>(NODE_SIZE, level.size() - i);
+        node.leaf = false;
+        node.box = level[i].box;
+        for (int j = 1; j < node.count; j++) {
+          node.box.extend(level[i + j].box);
+        }
+        parents.push_back(node);
+      }
+      level.swap(parents);
+    }
+    m_nodes.push_back(level[0]);
+    m_root = (int)m_nodes.size() - 1;
+  }
+
+  void clear() {
+    m_entries.clear();
+    m_nodes.clear();
+    m_root = -1;
+  }
+
+  size_t size() const {
+    return m_entries.size();
+  }
+
+  // calls f(id) for every entry whose box intersects the given box
+  template<class F>
+  void query(const RTreeBox &box, F f) const {
+    if (m_root < 0) {
+      return;
+    }
+    // at most NODE_SIZE - 1 siblings stay pending per tree level
+    int stack[NODE_SIZE * 16];
+    int top = 0;
+    stack[top++] = m_root;
+    while (top > 0) {
+      const Node &node = m_nodes[stack[--top]];
+      if (!node.box.intersects(box)) {
+        continue;
+      }
+      if (node.leaf) {
+        for (int i = node.first; i < node.first + node.count; i++) {
+          if (m_entries[i].box.intersects(box)) {
+            f(m_entries[i].id);
+          }
+        }
+      } else {
+        for (int i = node.first; i < node.first + node.count; i++) {
+          stack[top++] = i;
+        }
+      }
+    }
+  }
+
+private:
+  enum { NODE_SIZE = 16 };
+
+  struct Node {
+    RTreeBox box;
+    int first;  // first child node, or first entry of a leaf
+    int count;
+    bool leaf;
+  };
+
+  // orders items into vertical slabs by x, then each slab by y, so that
+  // consecutive runs of NODE_SIZE items are spatially compact
+  template<class T>
+  static void str_sort(std::vector<T> &items) {
+    const size_t n = items.size();
+    const size_t pages = (n + NODE_SIZE - 1) / NODE_SIZE;
+    const size_t slabs = (size_t)std::ceil(std::sqrt((double)pages));
+    const size_t slabSize = slabs * NODE_SIZE;
+    std::sort(items.begin(), items.end(), [](const T &a, const T &b) {
+      return a.box.x0 + a.box.x1 < b.box.x0 + b.box.x1;
+    });
+    for (size_t i = 0; i < n; i += slabSize) {
+      std::sort(items.begin() + i, items.begin() + std::min(n, i + slabSize), [](const T &a, const T &b) {
+        return a.box.y0 + a.box.y1 < b.box.y0 + b.box.y1;
+      });
+    }
+  }
+
+  std::vector<Entry> m_entries;
+  std::vector<Node> m_nodes;
+  int m_root = -1;
+};
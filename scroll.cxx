@@ -3,12 +3,38 @@
 #include <FL/Fl_Scroll.H>
 
 #include "event_handler.h"
+#include "wheel_scroll.h"
 
 
-class GScroll : public EventHandler<Fl_Scroll> {
+class GScroll : public EventHandler<WheelScroll<Fl_Scroll>> {
 public:
   GScroll(int x, int y, int w, int h, const char *label)
-    : EventHandler<Fl_Scroll>(x, y, w, h, label) {}
+    : EventHandler<WheelScroll<Fl_Scroll>>(x, y, w, h, label) {}
+
+protected:
+  void wheel_position(int &x, int &y) final {
+    x = xposition();
+    y = yposition();
+  }
+  void wheel_limits(int &minX, int &minY, int &maxX, int &maxY) final {
+    ScrollInfo si;
+    recalc_scrollbars(si);
+    minX = si.hscroll.first;
+    maxX = si.hscroll.total - si.hscroll.size + si.hscroll.first;
+    minY = si.vscroll.first;
+    maxY = si.vscroll.total - si.vscroll.size + si.vscroll.first;
+    if (!si.hneeded) maxX = minX = xposition();
+    if (!si.vneeded) maxY = minY = yposition();
+  }
+  void wheel_scroll_to(int x, int y) final {
+    scroll_to(x, y);
+  }
+  double wheel_line_size() final {
+    return scrollbar.linesize();
+  }
+  bool wheel_scrollbar(Fl_Widget *child) final {
+    return child == &scrollbar || child == &hscrollbar;
+  }
 };
 
 GScroll *go_fltk_new_Scroll(int x, int y, int w, int h, const char *label) {
@@ -24,6 +50,9 @@ int go_fltk_Scroll_x_position(Fl_Scroll *scroll) {
 int go_fltk_Scroll_y_position(Fl_Scroll *scroll) {
   return scroll->yposition();
 }  
+void go_fltk_Scroll_set_wheel_scroll_mode(GScroll *scroll, int mode, double step) {
+  scroll->set_wheel_scroll_mode(mode, step);
+}
 
 const unsigned char go_FL_SCROLL_HORIZONTAL = Fl_Scroll::HORIZONTAL;
 const unsigned char go_FL_SCROLL_VERTICAL = Fl_Scroll::VERTICAL;
@@ -31,3 +60,7 @@ const unsigned char go_FL_SCROLL_BOTH = Fl_Scroll::BOTH;
 const unsigned char go_FL_SCROLL_HORIZONTAL_ALWAYS = Fl_Scroll::HORIZONTAL_ALWAYS;
 const unsigned char go_FL_SCROLL_VERTICAL_ALWAYS = Fl_Scroll::VERTICAL_ALWAYS;
 const unsigned char go_FL_SCROLL_BOTH_ALWAYS = Fl_Scroll::BOTH_ALWAYS;
+
+const int go_WHEEL_SCROLL_IMMEDIATE = WHEEL_SCROLL_IMMEDIATE;
+const int go_WHEEL_SCROLL_COALESCED = WHEEL_SCROLL_COALESCED;
+const int go_WHEEL_SCROLL_SMOOTH = WHEEL_SCROLL_SMOOTH;
@@ -40,3 +40,29 @@ var (
 func (s *Scroll) SetType(scrollType ScrollType) {
 	s.widget.SetType(uint8(scrollType))
 }
+
+type WheelScrollMode int
+
+var (
+	// WheelScrollImmediate applies every mouse wheel event as it arrives (default).
+	WheelScrollImmediate = WheelScrollMode(C.go_WHEEL_SCROLL_IMMEDIATE)
+	// WheelScrollCoalesced merges all wheel events received within a frame
+	// into a single scroll offset update and a single redraw.
+	WheelScrollCoalesced = WheelScrollMode(C.go_WHEEL_SCROLL_COALESCED)
+	// WheelScrollSmooth coalesces wheel events and animates the scroll
+	// offset towards its target over the following frames.
+	WheelScrollSmooth = WheelScrollMode(C.go_WHEEL_SCROLL_SMOOTH)
+)
+
+// SetWheelScrollMode sets how mouse wheel and trackpad scrolling is applied.
+// step is the number of pixels scrolled per wheel unit and may be fractional;
+// if it is omitted or not positive the scrollbar's line size is used.
+//
+// In the coalesced modes wheel events are consumed by the Scroll itself,
+// so they are not delivered to scrollable children.
+func (s *Scroll) SetWheelScrollMode(mode WheelScrollMode, step ...float64) {
+	if len(step) < 1 {
+		step = append(step, 0)
+	}
+	C.go_fltk_Scroll_set_wheel_scroll_mode((*C.GScroll)(s.ptr()), C.int(mode), C.double(step[0]))
+}
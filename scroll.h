@@ -11,6 +11,7 @@ extern "C" {
   extern void go_fltk_Scroll_scroll_to(Fl_Scroll* scroll, int x, int y);
   extern int go_fltk_Scroll_x_position(Fl_Scroll* scroll);
   extern int go_fltk_Scroll_y_position(Fl_Scroll* scroll);
+  extern void go_fltk_Scroll_set_wheel_scroll_mode(GScroll* scroll, int mode, double step);
 
   extern const unsigned char go_FL_SCROLL_HORIZONTAL;
   extern const unsigned char go_FL_SCROLL_VERTICAL;
@@ -19,6 +20,10 @@ extern "C" {
   extern const unsigned char go_FL_SCROLL_VERTICAL_ALWAYS;
   extern const unsigned char go_FL_SCROLL_BOTH_ALWAYS;
 
+  extern const int go_WHEEL_SCROLL_IMMEDIATE;
+  extern const int go_WHEEL_SCROLL_COALESCED;
+  extern const int go_WHEEL_SCROLL_SMOOTH;
+
 #ifdef __cplusplus
 }
 #endif
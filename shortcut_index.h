@@ -0,0 +1,227 @@
+#pragma once
+
+#include <ctype.h>
+#include <string.h>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <FL/Fl.H>
+#include <FL/Fl_Menu_.H>
+#include <FL/Fl_Menu_Bar.H>
+#include <FL/Fl_Menu_Item.H>
+#include <FL/Fl_Multi_Label.H>
+#include <FL/fl_utf8.h>
+
+
+class WidgetWithShortcutIndex {
+public:
+  virtual void invalidate_shortcuts() = 0;
+  virtual int find_shortcut(unsigned int shortcut) = 0;
+};
+
+// ShortcutIndex resolves FL_SHORTCUT events through a hash of the menu's
+// item shortcuts instead of FLTK's walk over every item of the menu, which
+// runs for every menu on every keystroke. The index is rebuilt after the
+// menu changes; FLTK's own handling is still used for keystrokes that may
+// trigger label mnemonics ("&File"), whose rules it alone implements.
+template<class BaseMenu>
+class ShortcutIndex : public BaseMenu, public WidgetWithShortcutIndex {
+public:
+  template<class... Arg>
+  ShortcutIndex(Arg... args)
+    : BaseMenu(args...) {}
+
+  int handle(int event) override {
+    if (event != FL_SHORTCUT) {
+      return BaseMenu::handle(event);
+    }
+    update();
+    if (m_mnemonics && (Fl::event_state(FL_ALT) || has_mnemonic(this->label()))) {
+      return BaseMenu::handle(event);
+    }
+    const Fl_Menu_Item *item = match();
+    if (!item) {
+      return 0;
+    }
+    // a menu bar pulls down the submenu of a title when it is shown, which
+    // FLTK does
+    if (std::is_base_of<Fl_Menu_Bar, BaseMenu>::value && item->submenu()) {
+      return BaseMenu::handle(event);
+    }
+    // a choice shows the picked item
+    if (item != this->mvalue()) {
+      this->redraw();
+    }
+    this->picked(item);
+    return 1;
+  }
+
+  void invalidate_shortcuts() override {
+    m_items = NULL;
+  }
+
+  int find_shortcut(unsigned int shortcut) override {
+    update();
+    auto bucket = m_buckets.find(bucket_key(shortcut));
+    if (bucket == m_buckets.end()) {
+      return -1;
+    }
+    for (int i : bucket->second) {
+      if (this->menu()[i].shortcut() == (int)shortcut) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+private:
+  // shortcuts are matched against the key and the text of the event, case
+  // insensitively, so they are bucketed by their lower case key
+  static unsigned int bucket_key(unsigned int shortcut) {
+    unsigned int key = shortcut & FL_KEY_MASK;
+    return key < 128 ? (unsigned int)tolower((int)key) : key;
+  }
+
+  static bool has_mnemonic(const char *label) {
+    for (const char *p = label ? strchr(label, '&') : NULL; p; p = strchr(p + 2, '&')) {
+      if (p[1] != '&') {
+        return p[1] != 0;
+      }
+    }
+    return false;
+  }
+
+  static bool item_has_mnemonic(const Fl_Menu_Item &item) {
+    switch (item.labeltype()) {
+    case FL_NORMAL_LABEL:
+    case _FL_SHADOW_LABEL:
+    case _FL_ENGRAVED_LABEL:
+    case _FL_EMBOSSED_LABEL:
+      return has_mnemonic(item.label());
+    case _FL_MULTI_LABEL: {
+      const Fl_Multi_Label *ml = (const Fl_Multi_Label *)item.label();
+      return (ml->typea == FL_NORMAL_LABEL && has_mnemonic(ml->labela)) ||
+             (ml->typeb == FL_NORMAL_LABEL && has_mnemonic(ml->labelb));
+    }
+    default:
+      return false;
+    }
+  }
+
+  void update() {
+    if (m_items == this->menu() && m_size == this->size()) {
+      return;
+    }
+    m_items = this->menu();
+    m_size = this->size();
+    m_buckets.clear();
+    m_parents.assign(m_size > 0 ? m_size : 0, -1);
+    m_mnemonics = has_mnemonic(this->label());
+    std::vector<int> open;
+    for (int i = 0; i < m_size; i++) {
+      const Fl_Menu_Item &item = m_items[i];
+      if (!item.label()) {
+        if (!open.empty()) {
+          open.pop_back();
+        }
+        continue;
+      }
+      m_parents[i] = open.empty() ? -1 : open.back();
+      if (item.shortcut()) {
+        m_buckets[bucket_key((unsigned int)item.shortcut())].push_back(i);
+      }
+      // the items of a submenu pointer are not in this menu; FLTK handles
+      // menus with them, as it does mnemonics
+      if (!m_mnemonics && (item_has_mnemonic(item) || (item.flags & FL_SUBMENU_POINTER))) {
+        m_mnemonics = true;
+      }
+      if (item.flags & FL_SUBMENU) {
+        open.push_back(i);
+      }
+    }
+  }
+
+  // like Fl_Menu_Item::test_shortcut, only active items in active submenus
+  // match; hidden ones do
+  bool enabled(int i) const {
+    for (; i >= 0; i = m_parents[i]) {
+      if (!m_items[i].active()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // the item and its submenus, outermost first
+  void path(int i, std::vector<int> &res) const {
+    res.clear();
+    for (; i >= 0; i = m_parents[i]) {
+      res.insert(res.begin(), i);
+    }
+  }
+
+  // whether Fl_Menu_Item::test_shortcut prefers item a to item b: it takes
+  // the items of a menu before the items of its submenus, and the submenus
+  // in order
+  bool before(int a, int b) const {
+    std::vector<int> pa, pb;
+    path(a, pa);
+    path(b, pb);
+    size_t k = 0;
+    while (k < pa.size() && k < pb.size() && pa[k] == pb[k]) {
+      k++;
+    }
+    // a submenu title comes before its items
+    if (k == pa.size() || k == pb.size()) {
+      return k == pa.size();
+    }
+    const bool aHere = k + 1 == pa.size(), bHere = k + 1 == pb.size();
+    if (aHere != bHere) {
+      return aHere;
+    }
+    return pa[k] < pb[k];
+  }
+
+  // the item whose shortcut matches the current event. Fl::test_shortcut
+  // matches the key of the event, the first character of its text, and for
+  // Ctrl+'_' and the like the character whose control character the text
+  // is, so the buckets of all three are searched.
+  const Fl_Menu_Item *match() const {
+    unsigned int keys[3] = {bucket_key((unsigned int)Fl::event_key()), 0, 0};
+    const char *text = Fl::event_text();
+    const int length = Fl::event_length();
+    if (text && length > 0) {
+      const unsigned int c = fl_utf8decode(text, text + length, NULL);
+      keys[1] = bucket_key(c);
+      if (Fl::event_state(FL_CTRL) && (c < 0x20 || c == 0x7f)) {
+        keys[2] = bucket_key(c ^ 0x40);
+      }
+    }
+    int best = -1;
+    for (int k = 0; k < 3; k++) {
+      if (!keys[k] || (k >= 1 && keys[k] == keys[0]) || (k == 2 && keys[2] == keys[1])) {
+        continue;
+      }
+      auto bucket = m_buckets.find(keys[k]);
+      if (bucket == m_buckets.end()) {
+        continue;
+      }
+      for (int i : bucket->second) {
+        if (best >= 0 && !before(i, best)) {
+          continue;
+        }
+        if (Fl::test_shortcut((unsigned int)m_items[i].shortcut()) && enabled(i)) {
+          best = i;
+        }
+      }
+    }
+    return best >= 0 ? &m_items[best] : NULL;
+  }
+
+  const Fl_Menu_Item *m_items = NULL;
+  int m_size = 0;
+  bool m_mnemonics = false;
+  std::vector<int> m_parents;
+  std::unordered_map<unsigned int, std::vector<int>> m_buckets;
+};
@@ -3,23 +3,24 @@
 #include <FL/Fl_Slider.H>
 #include <FL/Fl_Value_Slider.H>
 
+#include "callback_coalescing.h"
 #include "event_handler.h"
 
 
-class GSlider : public EventHandler<Fl_Slider> {
+class GSlider : public EventHandler<CallbackCoalescing<Fl_Slider>> {
 public:
   GSlider(int x, int y, int w, int h, const char* label)
-    : EventHandler<Fl_Slider>(x, y, w, h, label) {}
+    : EventHandler<CallbackCoalescing<Fl_Slider>>(x, y, w, h, label) {}
 };
 
 GSlider* go_fltk_new_Slider(int x, int y, int w, int h, const char* label) {
   return new GSlider(x, y, w, h, label);
 }
 
-class GValue_Slider : public EventHandler<Fl_Value_Slider> {
+class GValue_Slider : public EventHandler<CallbackCoalescing<Fl_Value_Slider>> {
 public:
   GValue_Slider(int x, int y, int w, int h, const char* label)
-    : EventHandler<Fl_Value_Slider>(x, y, w, h, label) {}
+    : EventHandler<CallbackCoalescing<Fl_Value_Slider>>(x, y, w, h, label) {}
 };
 
 GValue_Slider* go_fltk_new_Value_Slider(int x, int y, int w, int h, const char* label) {
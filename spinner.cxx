@@ -2,13 +2,14 @@
 
 #include <FL/Fl_Spinner.H>
 
+#include "callback_coalescing.h"
 #include "event_handler.h"
 
 
-class GSpinner : public EventHandler<Fl_Spinner> {
+class GSpinner : public EventHandler<CallbackCoalescing<Fl_Spinner>> {
 public:
   GSpinner(int x, int y, int w, int h, const char* label)
-    : EventHandler<Fl_Spinner>(x, y, w, h, label) {}
+    : EventHandler<CallbackCoalescing<Fl_Spinner>>(x, y, w, h, label) {}
 };
 
 GSpinner* go_fltk_new_Spinner(int x, int y, int w, int h, const char* label) {
@@ -41,3 +41,9 @@ func (s *Spinner) SetValue(val float64) {
 func (s *Spinner) Value() float64 {
 	return (float64)(C.go_fltk_Spinner_value((*C.Fl_Spinner)(s.ptr())))
 }
+
+// SetCallbackCoalescing makes the callback fire at most once per frame while
+// the value is changing, with the latest value.
+func (s *Spinner) SetCallbackCoalescing(enabled bool) {
+	s.setCallbackCoalescing(enabled)
+}
@@ -0,0 +1,145 @@
+package spreadsheet
+
+import (
+	"errors"
+	"fmt"
+	"math"
+	"strconv"
+	"strings"
+)
+
+// Cell identifies a cell by its zero based row and column.
+type Cell struct {
+	Row int
+	Col int
+}
+
+// ColumnName returns the spreadsheet name of the column: A, ..., Z, AA, AB, ...
+func ColumnName(col int) string {
+	var name []byte
+	for {
+		name = append([]byte{'A' + byte(col%26)}, name...)
+		col /= 26
+		if col <= 0 {
+			break
+		}
+		col--
+	}
+	return string(name)
+}
+
+// String returns the cell in A1 notation, e.g. Cell{Row: 4, Col: 1} is "B4".
+func (c Cell) String() string {
+	return ColumnName(c.Col) + strconv.Itoa(c.Row)
+}
+
+var ErrInvalidCell = errors.New("invalid cell reference")
+
+// ParseCell parses a cell in A1 notation (case insensitive).
+func ParseCell(s string) (Cell, error) {
+	s = strings.ToUpper(strings.TrimSpace(s))
+	i := 0
+	col := 0
+	for i < len(s) && s[i] >= 'A' && s[i] <= 'Z' {
+		col = col*26 + int(s[i]-'A') + 1
+		i++
+	}
+	if i == 0 || i == len(s) {
+		return Cell{}, fmt.Errorf("%w: %q", ErrInvalidCell, s)
+	}
+	row, err := strconv.Atoi(s[i:])
+	if err != nil || row < 0 {
+		return Cell{}, fmt.Errorf("%w: %q", ErrInvalidCell, s)
+	}
+	return Cell{Row: row, Col: col - 1}, nil
+}
+
+// Range is a rectangular block of cells, inclusive on both ends.
+type Range struct {
+	From Cell
+	To   Cell
+}
+
+// ParseRange parses a range like "B1:B4".
+func ParseRange(s string) (Range, error) {
+	parts := strings.Split(s, ":")
+	if len(parts) != 2 {
+		return Range{}, fmt.Errorf("%w: %q", ErrInvalidCell, s)
+	}
+	from, err := ParseCell(parts[0])
+	if err != nil {
+		return Range{}, err
+	}
+	to, err := ParseCell(parts[1])
+	if err != nil {
+		return Range{}, err
+	}
+	return Range{From: from, To: to}, nil
+}
+
+// Bounds returns the top-left and bottom-right corner of the range.
+func (r Range) Bounds() (top, left, bottom, right int) {
+	top, bottom = r.From.Row, r.To.Row
+	if top > bottom {
+		top, bottom = bottom, top
+	}
+	left, right = r.From.Col, r.To.Col
+	if left > right {
+		left, right = right, left
+	}
+	return top, left, bottom, right
+}
+
+// Cells returns all cells of the range in row major order.
+func (r Range) Cells() []Cell {
+	top, left, bottom, right := r.Bounds()
+	cells := make([]Cell, 0, (bottom-top+1)*(right-left+1))
+	for row := top; row <= bottom; row++ {
+		for col := left; col <= right; col++ {
+			cells = append(cells, Cell{Row: row, Col: col})
+		}
+	}
+	return cells
+}
+
+func (r Range) String() string {
+	return r.From.String() + ":" + r.To.String()
+}
+
+// Value is the computed content of a cell. A cell holds either a number,
+// a text or an evaluation error.
+type Value struct {
+	Number float64
+	Text   string
+	Err    error
+}
+
+func Number(n float64) Value { return Value{Number: n} }
+func Text(s string) Value    { return Value{Text: s} }
+func Error(err error) Value  { return Value{Number: math.NaN(), Err: err} }
+
+func (v Value) IsError() bool { return v.Err != nil }
+
+// Float returns the numeric value of the cell. Text evaluates to 0.
+func (v Value) Float() float64 { return v.Number }
+
+// String formats the value for display.
+func (v Value) String() string {
+	if v.Err != nil {
+		return v.Err.Error()
+	}
+	if v.Text != "" {
+		return v.Text
+	}
+	return strconv.FormatFloat(v.Number, 'f', -1, 64)
+}
+
+func (v Value) equal(o Value) bool {
+	if v.Err != nil || o.Err != nil {
+		return v.Err == o.Err
+	}
+	if v.Text != o.Text {
+		return false
+	}
+	return v.Number == o.Number || (math.IsNaN(v.Number) && math.IsNaN(o.Number))
+}
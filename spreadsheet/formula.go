@@ -0,0 +1,77 @@
+package spreadsheet
+
+import (
+	"errors"
+	"regexp"
+	"strconv"
+	"strings"
+)
+
+// Formula computes a cell's value from the values of other cells.
+//
+// Eval may be called from several goroutines at once for different cells, so
+// it must not modify shared state; the value function it receives is safe to
+// call concurrently.
+type Formula interface {
+	// Dependencies returns the cells read by Eval.
+	Dependencies() []Cell
+	// Eval computes the value of the formula.
+	Eval(value func(Cell) Value) Value
+}
+
+// Ref is a formula that copies the value of another cell.
+type Ref Cell
+
+func (r Ref) Dependencies() []Cell { return []Cell{Cell(r)} }
+func (r Ref) Eval(value func(Cell) Value) Value {
+	return value(Cell(r))
+}
+
+// Sum is a formula adding up all cells of a range. Text cells count as zero,
+// errors are propagated.
+type Sum Range
+
+func (s Sum) Dependencies() []Cell { return Range(s).Cells() }
+func (s Sum) Eval(value func(Cell) Value) Value {
+	top, left, bottom, right := Range(s).Bounds()
+	sum := 0.0
+	for row := top; row <= bottom; row++ {
+		for col := left; col <= right; col++ {
+			v := value(Cell{Row: row, Col: col})
+			if v.IsError() {
+				return v
+			}
+			sum += v.Float()
+		}
+	}
+	return Number(sum)
+}
+
+var ErrUnsupportedFormula = errors.New("unsupported formula")
+
+var reSumFormula = regexp.MustCompile(`(?i)^SUM\(([A-Z]+\d+:[A-Z]+\d+)\)$`)
+
+// Parse interprets user input the way a simple spreadsheet does: "=SUM(A1:B2)"
+// and "=A1" become formulas, anything else a number or a text value.
+// Exactly one of the returned formula and value is meaningful; formula is nil
+// for constant cells.
+func Parse(input string) (Formula, Value, error) {
+	if !strings.HasPrefix(input, "=") {
+		if n, err := strconv.ParseFloat(strings.TrimSpace(input), 64); err == nil {
+			return nil, Number(n), nil
+		}
+		return nil, Text(input), nil
+	}
+	expr := strings.TrimSpace(input[1:])
+	if m := reSumFormula.FindStringSubmatch(expr); m != nil {
+		r, err := ParseRange(m[1])
+		if err != nil {
+			return nil, Value{}, err
+		}
+		return Sum(r), Value{}, nil
+	}
+	if c, err := ParseCell(expr); err == nil {
+		return Ref(c), Value{}, nil
+	}
+	return nil, Value{}, ErrUnsupportedFormula
+}
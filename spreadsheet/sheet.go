@@ -0,0 +1,285 @@
+// Package spreadsheet is an incremental recalculation engine for grid models,
+// such as the one behind the 7GUIs cells example.
+//
+// Cells are kept in a dependency graph. Editing a cell only re-evaluates the
+// cells that transitively depend on it, in topological order. Cells at the
+// same depth of the graph do not depend on each other and are evaluated in
+// parallel when there are enough of them. Change listeners receive only the
+// cells whose value actually changed, which is exactly the set of table cells
+// that need to be redrawn.
+//
+// A Sheet is not safe for concurrent use; it is meant to be driven from the
+// UI thread.
+package spreadsheet
+
+import (
+	"errors"
+	"runtime"
+	"sync"
+)
+
+var ErrCircularReference = errors.New("circular reference")
+
+// DefaultParallelThreshold is the default minimum number of independent cells
+// evaluated in parallel.
+const DefaultParallelThreshold = 256
+
+type node struct {
+	value      Value
+	input      string
+	formula    Formula
+	deps       []Cell
+	dependents map[Cell]struct{}
+
+	// recalculation scratch state, valid only when epoch matches Sheet.epoch
+	epoch   uint64
+	pending int
+	changed bool
+}
+
+type Sheet struct {
+	nodes     map[Cell]*node
+	listeners []func(changed []Cell)
+	epoch     uint64
+
+	// ParallelThreshold is the minimum number of independent dirty cells
+	// for which evaluation is spread across goroutines.
+	ParallelThreshold int
+}
+
+func NewSheet() *Sheet {
+	return &Sheet{
+		nodes:             make(map[Cell]*node),
+		ParallelThreshold: DefaultParallelThreshold,
+	}
+}
+
+// OnChange registers a function called after every edit with the cells whose
+// value changed.
+func (s *Sheet) OnChange(fn func(changed []Cell)) {
+	s.listeners = append(s.listeners, fn)
+}
+
+// Value returns the current value of the cell.
+func (s *Sheet) Value(c Cell) Value {
+	if n, ok := s.nodes[c]; ok {
+		return n.value
+	}
+	return Value{}
+}
+
+// Input returns the text the cell was last set to with Set.
+func (s *Sheet) Input(c Cell) string {
+	if n, ok := s.nodes[c]; ok {
+		return n.input
+	}
+	return ""
+}
+
+// Formula returns the cell's formula, or nil for constant cells.
+func (s *Sheet) Formula(c Cell) Formula {
+	if n, ok := s.nodes[c]; ok {
+		return n.formula
+	}
+	return nil
+}
+
+// Set parses the user input with Parse and stores it in the cell.
+// It returns the cells whose value changed.
+func (s *Sheet) Set(c Cell, input string) []Cell {
+	formula, value, err := Parse(input)
+	n := s.node(c)
+	n.input = input
+	if err != nil {
+		s.setFormula(c, n, nil)
+		n.value = Error(err)
+		return s.recalculate(c, true)
+	}
+	if formula != nil {
+		return s.SetFormula(c, formula)
+	}
+	return s.SetValue(c, value)
+}
+
+// SetValue stores a constant in the cell and returns the cells whose value
+// changed.
+func (s *Sheet) SetValue(c Cell, v Value) []Cell {
+	n := s.node(c)
+	s.setFormula(c, n, nil)
+	changed := !n.value.equal(v)
+	n.value = v
+	return s.recalculate(c, changed)
+}
+
+// SetFormula stores a formula in the cell and returns the cells whose value
+// changed.
+func (s *Sheet) SetFormula(c Cell, f Formula) []Cell {
+	n := s.node(c)
+	s.setFormula(c, n, f)
+	return s.recalculate(c, false)
+}
+
+func (s *Sheet) node(c Cell) *node {
+	n, ok := s.nodes[c]
+	if !ok {
+		n = &node{}
+		s.nodes[c] = n
+	}
+	return n
+}
+
+func (s *Sheet) setFormula(c Cell, n *node, f Formula) {
+	for _, d := range n.deps {
+		delete(s.nodes[d].dependents, c)
+	}
+	n.formula = f
+	n.deps = n.deps[:0]
+	if f == nil {
+		return
+	}
+	seen := make(map[Cell]struct{})
+	for _, d := range f.Dependencies() {
+		if _, dup := seen[d]; dup {
+			continue
+		}
+		seen[d] = struct{}{}
+		n.deps = append(n.deps, d)
+		dn := s.node(d)
+		if dn.dependents == nil {
+			dn.dependents = make(map[Cell]struct{})
+		}
+		dn.dependents[c] = struct{}{}
+	}
+}
+
+// recalculate re-evaluates start (if it holds a formula) and everything that
+// depends on it. startChanged reports whether start's value was modified by
+// the caller.
+func (s *Sheet) recalculate(start Cell, startChanged bool) []Cell {
+	s.epoch++
+	epoch := s.epoch
+
+	// collect the dirty subgraph reachable from start
+	dirty := []Cell{start}
+	s.nodes[start].epoch = epoch
+	for i := 0; i < len(dirty); i++ {
+		for d := range s.nodes[dirty[i]].dependents {
+			dn := s.nodes[d]
+			if dn.epoch != epoch {
+				dn.epoch = epoch
+				dn.pending = 0
+				dn.changed = false
+				dirty = append(dirty, d)
+			}
+		}
+	}
+	startNode := s.nodes[start]
+	startNode.pending = 0
+	startNode.changed = startChanged
+
+	// count dirty dependencies, which have to be evaluated first
+	for _, c := range dirty {
+		n := s.nodes[c]
+		for _, d := range n.deps {
+			if s.nodes[d].epoch == epoch {
+				n.pending++
+			}
+		}
+	}
+
+	// evaluate the graph level by level (Kahn's algorithm)
+	var level []Cell
+	for _, c := range dirty {
+		if s.nodes[c].pending == 0 {
+			level = append(level, c)
+		}
+	}
+	evaluated := 0
+	for len(level) > 0 {
+		s.evaluate(level)
+		evaluated += len(level)
+		var next []Cell
+		for _, c := range level {
+			for d := range s.nodes[c].dependents {
+				dn := s.nodes[d]
+				dn.pending--
+				if dn.pending == 0 {
+					next = append(next, d)
+				}
+			}
+		}
+		level = next
+	}
+
+	// whatever is left is part of, or depends on, a cycle
+	if evaluated < len(dirty) {
+		cycleErr := Error(ErrCircularReference)
+		for _, c := range dirty {
+			n := s.nodes[c]
+			if n.pending > 0 && n.formula != nil {
+				n.changed = n.changed || !n.value.equal(cycleErr)
+				n.value = cycleErr
+			}
+		}
+	}
+
+	var changed []Cell
+	for _, c := range dirty {
+		if s.nodes[c].changed {
+			changed = append(changed, c)
+		}
+	}
+	if len(changed) > 0 {
+		for _, listener := range s.listeners {
+			listener(changed)
+		}
+	}
+	return changed
+}
+
+func (s *Sheet) evaluate(cells []Cell) {
+	workers := runtime.GOMAXPROCS(0)
+	threshold := s.ParallelThreshold
+	if threshold <= 0 {
+		threshold = DefaultParallelThreshold
+	}
+	if workers < 2 || len(cells) < threshold {
+		for _, c := range cells {
+			s.evaluateCell(s.nodes[c])
+		}
+		return
+	}
+	// nodes are looked up before starting the goroutines, as evaluating
+	// formulas only reads the map
+	nodes := make([]*node, len(cells))
+	for i, c := range cells {
+		nodes[i] = s.nodes[c]
+	}
+	chunk := (len(nodes) + workers - 1) / workers
+	var wg sync.WaitGroup
+	for start := 0; start < len(nodes); start += chunk {
+		end := start + chunk
+		if end > len(nodes) {
+			end = len(nodes)
+		}
+		wg.Add(1)
+		go func(part []*node) {
+			defer wg.Done()
+			for _, n := range part {
+				s.evaluateCell(n)
+			}
+		}(nodes[start:end])
+	}
+	wg.Wait()
+}
+
+func (s *Sheet) evaluateCell(n *node) {
+	if n.formula == nil {
+		return
+	}
+	v := n.formula.Eval(s.Value)
+	if !n.value.equal(v) {
+		n.value = v
+		n.changed = true
+	}
+}
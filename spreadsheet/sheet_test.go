@@ -0,0 +1,119 @@
+package spreadsheet
+
+import (
+	"errors"
+	"sort"
+	"testing"
+)
+
+func mustCell(t *testing.T, s string) Cell {
+	t.Helper()
+	c, err := ParseCell(s)
+	if err != nil {
+		t.Fatal(err)
+	}
+	return c
+}
+
+func cellNames(cells []Cell) []string {
+	names := make([]string, len(cells))
+	for i, c := range cells {
+		names[i] = c.String()
+	}
+	sort.Strings(names)
+	return names
+}
+
+func TestParseCell(t *testing.T) {
+	for _, name := range []string{"A0", "B4", "Z99", "AA1", "AZ7", "BA0"} {
+		c := mustCell(t, name)
+		if c.String() != name {
+			t.Errorf("ParseCell(%q).String() = %q", name, c.String())
+		}
+	}
+	for _, name := range []string{"", "A", "4", "A-1", "1A"} {
+		if _, err := ParseCell(name); !errors.Is(err, ErrInvalidCell) {
+			t.Errorf("ParseCell(%q) error = %v", name, err)
+		}
+	}
+}
+
+func TestIncrementalRecalculation(t *testing.T) {
+	s := NewSheet()
+	s.Set(mustCell(t, "A0"), "1")
+	s.Set(mustCell(t, "A1"), "2")
+	s.Set(mustCell(t, "B0"), "=SUM(A0:A1)")
+	s.Set(mustCell(t, "C0"), "=B0")
+	s.Set(mustCell(t, "D0"), "7")
+
+	if v := s.Value(mustCell(t, "C0")); v.Float() != 3 {
+		t.Fatalf("C0 = %v, want 3", v)
+	}
+
+	var notified []Cell
+	s.OnChange(func(changed []Cell) { notified = changed })
+
+	changed := cellNames(s.Set(mustCell(t, "A1"), "5"))
+	if want := []string{"A1", "B0", "C0"}; !equalStrings(changed, want) {
+		t.Errorf("changed = %v, want %v", changed, want)
+	}
+	if got := cellNames(notified); !equalStrings(got, changed) {
+		t.Errorf("listener got %v, want %v", got, changed)
+	}
+	if v := s.Value(mustCell(t, "C0")); v.Float() != 6 {
+		t.Errorf("C0 = %v, want 6", v)
+	}
+
+	// unrelated cells and unchanged values are not reported
+	if changed := s.Set(mustCell(t, "A1"), "5"); len(changed) != 0 {
+		t.Errorf("setting the same value changed %v", cellNames(changed))
+	}
+}
+
+func TestCircularReference(t *testing.T) {
+	s := NewSheet()
+	s.Set(mustCell(t, "A0"), "=B0")
+	s.Set(mustCell(t, "B0"), "=A0")
+	for _, name := range []string{"A0", "B0"} {
+		if v := s.Value(mustCell(t, name)); !errors.Is(v.Err, ErrCircularReference) {
+			t.Errorf("%s = %v, want circular reference", name, v)
+		}
+	}
+	// breaking the cycle recovers both cells
+	s.Set(mustCell(t, "B0"), "4")
+	if v := s.Value(mustCell(t, "A0")); v.IsError() || v.Float() != 4 {
+		t.Errorf("A0 = %v, want 4", v)
+	}
+}
+
+func TestParallelLevels(t *testing.T) {
+	s := NewSheet()
+	s.ParallelThreshold = 2
+	root := Cell{Row: 0, Col: 0}
+	s.SetValue(root, Number(1))
+	for row := 1; row < 1000; row++ {
+		s.SetFormula(Cell{Row: row, Col: 0}, Ref(root))
+		s.SetFormula(Cell{Row: row, Col: 1}, Sum(Range{From: Cell{Row: row, Col: 0}, To: Cell{Row: 0, Col: 0}}))
+	}
+	changed := s.SetValue(root, Number(2))
+	if len(changed) != 1+2*999 {
+		t.Fatalf("%d cells changed, want %d", len(changed), 1+2*999)
+	}
+	for row := 1; row < 1000; row++ {
+		if v := s.Value(Cell{Row: row, Col: 1}); v.Float() != float64(2*(row+1)) {
+			t.Fatalf("B%d = %v, want %d", row, v, 2*(row+1))
+		}
+	}
+}
+
+func equalStrings(a, b []string) bool {
+	if len(a) != len(b) {
+		return false
+	}
+	for i := range a {
+		if a[i] != b[i] {
+			return false
+		}
+	}
+	return true
+}
@@ -0,0 +1,68 @@
+package fltk_go
+
+/*
+#include <stdlib.h>
+#include "fltk.h"
+*/
+import "C"
+import (
+	"time"
+	"unsafe"
+)
+
+// StartupPhase is a step of the application startup, with times measured
+// from when the library was loaded.
+type StartupPhase struct {
+	Name     string
+	Start    time.Duration
+	Duration time.Duration
+}
+
+func secondsToDuration(s C.double) time.Duration {
+	return time.Duration(float64(s) * float64(time.Second))
+}
+
+// StartupTrace returns the startup phases recorded so far: scheme and style
+// initialization, font enumeration, image format registration, window
+// creation, the start of the event loop and any phase added with
+// StartupSpan. Recording stops when the first frame has been drawn.
+func StartupTrace() []StartupPhase {
+	n := int(C.go_fltk_startup_trace_count())
+	phases := make([]StartupPhase, 0, n)
+	for i := 0; i < n; i++ {
+		var start, end C.double
+		name := C.go_fltk_startup_trace_event(C.int(i), &start, &end)
+		if name == nil {
+			break
+		}
+		phases = append(phases, StartupPhase{
+			Name:     C.GoString(name),
+			Start:    secondsToDuration(start),
+			Duration: secondsToDuration(end - start),
+		})
+	}
+	return phases
+}
+
+// TimeToFirstFrame returns the time from loading the library until a window
+// was first drawn, and false if that has not happened yet.
+func TimeToFirstFrame() (time.Duration, bool) {
+	t := C.go_fltk_startup_first_frame()
+	if t < 0 {
+		return 0, false
+	}
+	return secondsToDuration(t), true
+}
+
+// StartupSpan adds an application phase to the startup trace. It starts the
+// phase and returns the function ending it:
+//
+//	defer fltk_go.StartupSpan("load config")()
+func StartupSpan(name string) func() {
+	start := C.go_fltk_startup_trace_now()
+	return func() {
+		cname := C.CString(name)
+		defer C.free(unsafe.Pointer(cname))
+		C.go_fltk_startup_trace_record(cname, start, C.go_fltk_startup_trace_now())
+	}
+}
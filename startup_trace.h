@@ -0,0 +1,21 @@
+#pragma once
+
+// Startup trace shared by the subsystem initializers. Times are seconds since
+// the library was loaded; recording stops once the first frame is drawn.
+
+double startup_trace_now();
+void startup_trace_record(const char *name, double start, double end);
+void startup_trace_first_frame();
+
+class StartupSpan {
+public:
+  explicit StartupSpan(const char *name)
+    : m_name(name), m_start(startup_trace_now()) {}
+  ~StartupSpan() {
+    startup_trace_record(m_name, m_start, startup_trace_now());
+  }
+
+private:
+  const char *m_name;
+  double m_start;
+};
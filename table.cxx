@@ -2,15 +2,20 @@
 
 #include <FL/Fl_Table_Row.H>
 
+#include <FL/Fl_Scrollbar.H>
+
+#include <algorithm>
+
 #include "event_handler.h"
+#include "wheel_scroll.h"
 
 #include "_cgo_export.h"
 
 
-class GTableRow : public EventHandler<Fl_Table_Row> {
+class GTableRow : public EventHandler<WheelScroll<Fl_Table_Row>> {
 public:
   GTableRow(int x, int y, int w, int h)
-    : EventHandler<Fl_Table_Row>(x, y, w, h) {}
+    : EventHandler<WheelScroll<Fl_Table_Row>>(x, y, w, h) {}
   
   void set_draw_cell_callback(int drawFunId) {
     m_drawFunId = drawFunId;
@@ -27,7 +32,42 @@ public:
     *x = X, *y = Y, *w = W, *h = H;
     return ret;
   }
+
+  void redraw_range_(int topRow, int bottomRow, int leftCol, int rightCol) {
+    this->redraw_range(topRow, bottomRow, leftCol, rightCol);
+  }
+
+  // scrolls the least needed to show the cell, or its top left corner when
+  // it is larger than the area of the cells
+  void show_cell(int r, int c) {
+    if (r < 0 || r >= rows() || c < 0 || c >= cols()) {
+      return;
+    }
+    int minX, minY, maxX, maxY;
+    wheel_limits(minX, minY, maxX, maxY);
+    const int x = scroll_to_show(hscrollbar->value(), col_scroll_position(c), col_width(c), tiw, minX, maxX);
+    const int y = scroll_to_show(vscrollbar->value(), row_scroll_position(r), row_height(r), tih, minY, maxY);
+    if (x != hscrollbar->value() || y != vscrollbar->value()) {
+      wheel_scroll_to(x, y);
+    }
+  }
 	
+  bool tooltip_item(int &a, int &b, void *&item, int &X, int &Y, int &W, int &H) final {
+    int R = 0, C = 0;
+    ResizeFlag rflag = RESIZE_NONE;
+    TableContext ctx = cursor2rowcol(R, C, rflag);
+    if (ctx == CONTEXT_ROW_HEADER) {
+      C = -1;
+    } else if (ctx == CONTEXT_COL_HEADER) {
+      R = -1;
+    } else if (ctx != CONTEXT_CELL || rflag != RESIZE_NONE) {
+      return false;
+    }
+    item = NULL;
+    a = R, b = C;
+    return this->find_cell(ctx, ctx == CONTEXT_COL_HEADER ? 0 : R, ctx == CONTEXT_ROW_HEADER ? 0 : C, X, Y, W, H) == 0;
+  }
+
   int row_from_cursor() {
 	int row = 0;
 	int col = 0;
@@ -52,7 +92,43 @@ public:
 	return col;
   }
 	
+protected:
+  void wheel_position(int &x, int &y) final {
+    x = hscrollbar->value();
+    y = vscrollbar->value();
+  }
+  void wheel_limits(int &minX, int &minY, int &maxX, int &maxY) final {
+    minX = (int)hscrollbar->minimum();
+    maxX = (int)hscrollbar->maximum();
+    minY = (int)vscrollbar->minimum();
+    maxY = (int)vscrollbar->maximum();
+    if (!hscrollbar->visible()) maxX = minX = hscrollbar->value();
+    if (!vscrollbar->visible()) maxY = minY = vscrollbar->value();
+  }
+  void wheel_scroll_to(int x, int y) final {
+    hscrollbar->value(x);
+    vscrollbar->value(y);
+    table_scrolled();
+    redraw();
+  }
+  double wheel_line_size() final {
+    return vscrollbar->linesize();
+  }
+  bool wheel_scrollbar(Fl_Widget *child) final {
+    return child == vscrollbar || child == hscrollbar;
+  }
+
 private:
+  static int scroll_to_show(int value, long pos, int size, int area, int min, int max) {
+    if (pos + size > value + area) {
+      value = (int)(pos + size - area);
+    }
+    if (pos < value) {
+      value = (int)pos;
+    }
+    return std::max(min, std::min(max, value));
+  }
+
   int m_drawFunId = 0;
 };
 
@@ -77,6 +153,12 @@ void go_fltk_TableRow_select_row(GTableRow* t, int row, int flag) {
 int go_fltk_TableRow_find_cell(GTableRow* t, int ctx, int r, int c, int *x, int *y, int *w, int *h) {
   return t->find_cell_(ctx, r, c, x, y, w, h);
 }
+void go_fltk_TableRow_redraw_range(GTableRow* t, int topRow, int bottomRow, int leftCol, int rightCol) {
+  t->redraw_range_(topRow, bottomRow, leftCol, rightCol);
+}
+void go_fltk_TableRow_show_cell(GTableRow* t, int row, int col) {
+  t->show_cell(row, col);
+}
 void go_fltk_Table_set_row_count(Fl_Table* t, int rowCount) {
   t->rows(rowCount);
 }
@@ -98,6 +180,9 @@ void go_fltk_Table_set_row_resize(Fl_Table* t, int resize) {
 void go_fltk_Table_set_column_count(Fl_Table* t, int columnCount) {
   t->cols(columnCount);
 }
+int go_fltk_Table_column_count(Fl_Table* t) {
+	return t->cols();
+}
 void go_fltk_Table_set_column_width(Fl_Table* t, int column, int width) {
   t->col_width(column, width);
 }
@@ -149,12 +234,18 @@ void go_fltk_Table_set_row_header_width(Fl_Table* t, int size) {
 int go_fltk_Table_row_header_width(Fl_Table* t) {
 	return t->row_header_width();
 }
+void go_fltk_Table_add(Fl_Table* t, Fl_Widget* w) {
+  t->add(w);
+}
 int go_fltk_Table_column_from_cursor(GTableRow* t) {
 	return t->column_from_cursor();
 }
 int go_fltk_Table_row_from_cursor(GTableRow* t) {
 	return t->row_from_cursor();
 }
+void go_fltk_TableRow_set_wheel_scroll_mode(GTableRow* t, int mode, double step) {
+  t->set_wheel_scroll_mode(mode, step);
+}
 
 const int go_FL_CONTEXT_NONE = (int)Fl_Table::CONTEXT_NONE;
 const int go_FL_CONTEXT_STARTPAGE = (int)Fl_Table::CONTEXT_STARTPAGE;
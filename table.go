@@ -40,6 +40,9 @@ func (t *table) DisallowRowResizing() {
 func (t *table) SetColumnCount(columnCount int) {
 	C.go_fltk_Table_set_column_count((*C.Fl_Table)(t.ptr()), C.int(columnCount))
 }
+func (t *table) ColumnCount() int {
+	return int(C.go_fltk_Table_column_count((*C.Fl_Table)(t.ptr())))
+}
 func (t *table) SetColumnWidth(column, width int) {
 	C.go_fltk_Table_set_column_width((*C.Fl_Table)(t.ptr()), C.int(column), C.int(width))
 }
@@ -101,6 +104,12 @@ func (t *table) SetColumnHeaderHeight(size int) {
 func (t *table) ColumnHeaderHeight() int {
 	return int(C.go_fltk_Table_column_header_height((*C.Fl_Table)(t.ptr())))
 }
+
+// Add adds a widget to the area holding the cells, where it scrolls with
+// them. Group.Add would place it over the scrollbars and headers.
+func (t *table) Add(w Widget) {
+	C.go_fltk_Table_add((*C.Fl_Table)(t.ptr()), w.getWidget().ptr())
+}
 func (t *table) RowAndColumnFromCursor() (row, col int) {
 	row = int(C.go_fltk_Table_row_from_cursor((*C.GTableRow)(t.ptr())))
 	col = int(C.go_fltk_Table_column_from_cursor((*C.GTableRow)(t.ptr())))
@@ -190,6 +199,18 @@ func (t *TableRow) Destroy() {
 	t.drawCellCallbackId = 0
 	t.table.Destroy()
 }
+
+// SetCellTooltipProvider sets a function computing the tooltip of the cell
+// under the mouse. It is called once per hovered cell when the tooltip is
+// about to be shown; col is -1 for row headers and row is -1 for column
+// headers. An empty string shows no tooltip.
+func (t *TableRow) SetCellTooltipProvider(provider func(row, col int) string) {
+	if provider == nil {
+		t.setTooltipProvider(nil)
+		return
+	}
+	t.setTooltipProvider(func(row, col int, _ unsafe.Pointer) string { return provider(row, col) })
+}
 func (t *TableRow) IsRowSelected(row int) bool {
 	return C.go_fltk_TableRow_row_selected((*C.GTableRow)(t.ptr()), C.int(row)) != 0
 }
@@ -225,6 +246,31 @@ func (t *TableRow) FindCell(ctx TableContext, row int, col int) (int, int, int,
 	return int(x), int(y), int(w), int(h), err
 }
 
+// RedrawRange schedules a redraw of the given block of cells only, instead of
+// the whole table.
+func (t *TableRow) RedrawRange(topRow, bottomRow, leftCol, rightCol int) {
+	C.go_fltk_TableRow_redraw_range((*C.GTableRow)(t.ptr()), C.int(topRow), C.int(bottomRow), C.int(leftCol), C.int(rightCol))
+}
+
+// RedrawCell schedules a redraw of a single cell.
+func (t *TableRow) RedrawCell(row, col int) {
+	t.RedrawRange(row, row, col, col)
+}
+
+// ShowCell scrolls the table the least needed to show the cell.
+func (t *TableRow) ShowCell(row, col int) {
+	C.go_fltk_TableRow_show_cell((*C.GTableRow)(t.ptr()), C.int(row), C.int(col))
+}
+
+// SetWheelScrollMode sets how mouse wheel and trackpad scrolling is applied,
+// see Scroll.SetWheelScrollMode.
+func (t *TableRow) SetWheelScrollMode(mode WheelScrollMode, step ...float64) {
+	if len(step) < 1 {
+		step = append(step, 0)
+	}
+	C.go_fltk_TableRow_set_wheel_scroll_mode((*C.GTableRow)(t.ptr()), C.int(mode), C.double(step[0]))
+}
+
 type RowSelectMode int
 
 var (
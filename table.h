@@ -8,6 +8,7 @@ extern "C" {
 #endif
 
   typedef struct Fl_Table Fl_Table;
+  typedef struct Fl_Widget Fl_Widget;
   typedef struct GTableRow GTableRow;
 
   extern GTableRow* go_fltk_new_TableRow(int x, int y, int w, int h);
@@ -19,6 +20,7 @@ extern "C" {
   extern void go_fltk_Table_set_row_header(Fl_Table* t, int header);
   extern void go_fltk_Table_set_row_resize(Fl_Table* t, int resize);
   extern void go_fltk_Table_set_column_count(Fl_Table* t, int columnCount);
+  extern int go_fltk_Table_column_count(Fl_Table* t);
   extern void go_fltk_Table_set_column_width(Fl_Table* t, int column, int width);
   extern void go_fltk_Table_set_column_width_all(Fl_Table* t, int width);
   extern void go_fltk_Table_set_column_header(Fl_Table* t, int header);
@@ -36,6 +38,7 @@ extern "C" {
   extern void go_fltk_Table_set_row_header_width(Fl_Table* t, int size);
   extern int go_fltk_Table_column_header_height(Fl_Table* t);
   extern void go_fltk_Table_set_column_header_height(Fl_Table* t, int size);
+  extern void go_fltk_Table_add(Fl_Table* t, Fl_Widget* w);
 		
   extern int go_fltk_TableRow_row_selected(GTableRow* t, int row);
   extern void go_fltk_TableRow_set_draw_cell_callback(GTableRow* t, int drawCellCallback);
@@ -43,8 +46,11 @@ extern "C" {
   extern void go_fltk_TableRow_select_all_rows(GTableRow* t, int flag);
   extern void go_fltk_TableRow_select_row(GTableRow* t, int row, int flag);
   extern int go_fltk_TableRow_find_cell(GTableRow* t, int ctx, int row, int col, int *x, int *y, int *w, int *h);
+  extern void go_fltk_TableRow_redraw_range(GTableRow* t, int topRow, int bottomRow, int leftCol, int rightCol);
+  extern void go_fltk_TableRow_show_cell(GTableRow* t, int row, int col);
   extern int go_fltk_Table_column_from_cursor(GTableRow* t);
   extern int go_fltk_Table_row_from_cursor(GTableRow* t);
+  extern void go_fltk_TableRow_set_wheel_scroll_mode(GTableRow* t, int mode, double step);
 		
   extern const int go_FL_CONTEXT_NONE;
   extern const int go_FL_CONTEXT_STARTPAGE;
@@ -0,0 +1,307 @@
+package fltk_go
+
+import (
+	"strconv"
+)
+
+// TableModel holds the values of the cells shown and edited by a
+// TableEditor. A model may also implement ColumnName(col int) string to
+// name the column headers, which default to A, B, ... Z, AA, AB...
+type TableModel interface {
+	CellValue(row, col int) string
+	SetCellValue(row, col int, value string)
+}
+
+// CellEditor is a widget editing the value of a cell. Load puts the value
+// of the cell in the widget when editing starts and Value reads the edited
+// value back when it is committed.
+type CellEditor struct {
+	Widget Widget
+	Load   func(value string)
+	Value  func() string
+}
+
+// NewInputCellEditor returns an editor typing the value in an Input.
+func NewInputCellEditor() *CellEditor {
+	input := NewInput(0, 0, 10, 10)
+	return &CellEditor{
+		Widget: input,
+		Load: func(value string) {
+			input.SetValue(value)
+		},
+		Value: input.Value,
+	}
+}
+
+// NewChoiceCellEditor returns an editor picking the value among options. A
+// value that is not among them is kept until another one is picked.
+func NewChoiceCellEditor(options ...string) *CellEditor {
+	choice := NewChoice(0, 0, 10, 10)
+	for _, option := range options {
+		choice.Add(option, nil)
+	}
+	var loaded string
+	return &CellEditor{
+		Widget: choice,
+		Load: func(value string) {
+			loaded = value
+			for i, option := range options {
+				if option == value {
+					choice.SetValue(i)
+					return
+				}
+			}
+			choice.SetValue(-1)
+		},
+		Value: func() string {
+			if choice.Value() < 0 {
+				return loaded
+			}
+			return choice.SelectedText()
+		},
+	}
+}
+
+// TableEditor makes the cells of a TableRow editable without a widget per
+// cell. The table draws the values of the model itself, and the editor of
+// a cell is moved onto it when it is edited, by double clicking it or by
+// pressing Enter or F2 after clicking it. Enter or leaving the editor
+// commits the value to the model, Tab commits it and edits the next cell,
+// and Escape cancels the edit.
+//
+// Editors are set per column and each one is a single widget, however many
+// columns and rows it edits.
+type TableEditor struct {
+	table         *TableRow
+	model         TableModel
+	defaultEditor *CellEditor
+	editors       map[int]*CellEditor
+	// added to the table and wired
+	installed map[*CellEditor]bool
+	// the cell being edited, and the one last clicked
+	editing          *CellEditor
+	editRow, editCol int
+	row, col         int
+	// the value of the cell being edited when editing started
+	loaded string
+}
+
+// NewTableEditor takes over the drawing and the event handler of table,
+// whose cells are edited with an Input by default.
+func NewTableEditor(table *TableRow, model TableModel) *TableEditor {
+	e := &TableEditor{
+		table:     table,
+		model:     model,
+		editors:   make(map[int]*CellEditor),
+		installed: make(map[*CellEditor]bool),
+		row:       -1,
+		col:       -1,
+	}
+	e.defaultEditor = NewInputCellEditor()
+	e.install(e.defaultEditor)
+	table.SetDrawCellCallback(e.drawCell)
+	table.SetEventHandler(e.handleTable)
+	return e
+}
+
+// SetDefaultEditor sets the editor of the columns without one of their own;
+// nil makes them read-only.
+func (e *TableEditor) SetDefaultEditor(editor *CellEditor) {
+	e.Cancel()
+	e.defaultEditor = editor
+	e.install(editor)
+}
+
+// SetColumnEditor sets the editor of a column; nil restores the default.
+func (e *TableEditor) SetColumnEditor(col int, editor *CellEditor) {
+	e.Cancel()
+	if editor == nil {
+		delete(e.editors, col)
+		return
+	}
+	e.editors[col] = editor
+	e.install(editor)
+}
+
+func (e *TableEditor) editorFor(col int) *CellEditor {
+	if editor, ok := e.editors[col]; ok {
+		return editor
+	}
+	return e.defaultEditor
+}
+
+func (e *TableEditor) install(editor *CellEditor) {
+	if editor == nil || e.installed[editor] {
+		return
+	}
+	e.installed[editor] = true
+	w := editor.Widget.getWidget()
+	e.table.Add(editor.Widget)
+	w.Hide()
+	// Enter, a choice or leaving the widget commits
+	w.SetCallbackCondition(WhenReleaseAlways | WhenEnterKeyAlways)
+	w.SetCallback(func() {
+		if e.editing == editor {
+			e.Commit()
+		}
+	})
+	w.SetEventHandler(func(event Event) bool {
+		if event != KEY || e.editing != editor {
+			return false
+		}
+		switch EventKey() {
+		case ESCAPE:
+			e.Cancel()
+			return true
+		case TAB:
+			row, col := e.editRow, e.editCol+1
+			if col >= e.table.ColumnCount() {
+				row, col = row+1, 0
+			}
+			e.Commit()
+			if row < e.table.RowCount() {
+				e.Edit(row, col)
+			}
+			return true
+		}
+		return false
+	})
+}
+
+// Edit moves the editor of the column onto the cell and focuses it, after
+// committing the cell being edited and scrolling the table to show the
+// cell. It reports whether the cell is editable.
+func (e *TableEditor) Edit(row, col int) bool {
+	e.Commit()
+	editor := e.editorFor(col)
+	if editor == nil {
+		return false
+	}
+	// FindCell gives the place of off-screen cells outside of the table
+	e.table.ShowCell(row, col)
+	x, y, w, h, err := e.table.FindCell(ContextCell, row, col)
+	if err != nil {
+		return false
+	}
+	e.editing, e.editRow, e.editCol = editor, row, col
+	e.row, e.col = row, col
+	e.loaded = e.model.CellValue(row, col)
+	editor.Load(e.loaded)
+	widget := editor.Widget.getWidget()
+	widget.Resize(x, y, w, h)
+	widget.Show()
+	widget.TakeFocus()
+	return true
+}
+
+// Editing returns the cell being edited, if any.
+func (e *TableEditor) Editing() (row, col int, ok bool) {
+	return e.editRow, e.editCol, e.editing != nil
+}
+
+// Commit stores the value of the cell being edited in the model, unless it
+// was left unchanged, and hides its editor.
+func (e *TableEditor) Commit() {
+	editor := e.editing
+	if editor == nil {
+		return
+	}
+	if value := editor.Value(); value != e.loaded {
+		e.model.SetCellValue(e.editRow, e.editCol, value)
+	}
+	e.Cancel()
+}
+
+// Cancel hides the editor of the cell being edited without changing the
+// model.
+func (e *TableEditor) Cancel() {
+	editor := e.editing
+	if editor == nil {
+		return
+	}
+	// hiding the editor makes it lose the focus, which must not commit;
+	// the table gets it back unless the editor lost it to another widget
+	e.editing = nil
+	widget := editor.Widget.getWidget()
+	focused := widget.HasFocus()
+	widget.Hide()
+	if focused {
+		e.table.TakeFocus()
+	}
+	e.table.RedrawCell(e.editRow, e.editCol)
+}
+
+func (e *TableEditor) handleTable(event Event) bool {
+	switch event {
+	case PUSH:
+		row, col := e.table.RowAndColumnFromCursor()
+		if row < 0 || col < 0 {
+			return false
+		}
+		e.Commit()
+		e.row, e.col = row, col
+		if EventClicks() > 0 {
+			return e.Edit(row, col)
+		}
+	case KEY:
+		if e.editing != nil || e.row < 0 || e.row >= e.table.RowCount() || e.col >= e.table.ColumnCount() {
+			return false
+		}
+		if key := EventKey(); key == ENTER_KEY || key == F2 {
+			return e.Edit(e.row, e.col)
+		}
+	}
+	return false
+}
+
+func (e *TableEditor) drawCell(context TableContext, row, col, x, y, w, h int) {
+	switch context {
+	case ContextStartPage:
+		SetDrawFont(HELVETICA, 14)
+		// keep the editor on its cell as rows and columns are resized
+		if e.editing != nil {
+			if cx, cy, cw, ch, err := e.table.FindCell(ContextCell, e.editRow, e.editCol); err == nil {
+				widget := e.editing.Widget.getWidget()
+				if widget.X() != cx || widget.Y() != cy || widget.W() != cw || widget.H() != ch {
+					widget.Resize(cx, cy, cw, ch)
+				}
+			}
+		}
+	case ContextColHeader:
+		e.drawHeader(e.columnName(col), x, y, w, h)
+	case ContextRowHeader:
+		e.drawHeader(strconv.Itoa(row+1), x, y, w, h)
+	case ContextCell:
+		if e.editing != nil && row == e.editRow && col == e.editCol {
+			return
+		}
+		background, foreground := BACKGROUND2_COLOR, FOREGROUND_COLOR
+		if e.table.IsRowSelected(row) {
+			background, foreground = SELECTION_COLOR, WHITE
+		}
+		DrawBox(FLAT_BOX, x, y, w, h, background)
+		PushClip(x, y, w, h)
+		SetDrawColor(foreground)
+		Draw(e.model.CellValue(row, col), x+3, y, w-6, h, ALIGN_LEFT|ALIGN_INSIDE)
+		SetDrawColor(LIGHT2)
+		DrawRect(x, y, w, h)
+		PopClip()
+	}
+}
+
+func (e *TableEditor) drawHeader(label string, x, y, w, h int) {
+	DrawBox(THIN_UP_BOX, x, y, w, h, BACKGROUND_COLOR)
+	SetDrawColor(FOREGROUND_COLOR)
+	Draw(label, x, y, w, h, ALIGN_CENTER)
+}
+
+func (e *TableEditor) columnName(col int) string {
+	if named, ok := e.model.(interface{ ColumnName(int) string }); ok {
+		return named.ColumnName(col)
+	}
+	var name []byte
+	for col++; col > 0; col = (col - 1) / 26 {
+		name = append([]byte{byte('A' + (col-1)%26)}, name...)
+	}
+	return string(name)
+}
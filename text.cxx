@@ -194,6 +194,26 @@ void go_fltk_TextBuffer_delete(Fl_Text_Buffer* b) {
   delete b;
 }
 
+// TextBufferAccess reads the text in place. The buffer keeps it in two
+// parts around the gap where the last edit took place.
+struct TextBufferAccess : public Fl_Text_Buffer {
+  static void segments(Fl_Text_Buffer *b, const char *&first, int &firstLen, const char *&second, int &secondLen) {
+    // protected members can be named through a derived class and the
+    // resulting member pointers applied to any buffer
+    char *Fl_Text_Buffer::*buf = &TextBufferAccess::mBuf;
+    int Fl_Text_Buffer::*gapStart = &TextBufferAccess::mGapStart;
+    int Fl_Text_Buffer::*gapEnd = &TextBufferAccess::mGapEnd;
+    first = b->*buf;
+    firstLen = b->*gapStart;
+    second = b->*buf + b->*gapEnd;
+    secondLen = b->length() - b->*gapStart;
+  }
+};
+
+void go_fltk_TextBuffer_segments(Fl_Text_Buffer *b, const char **first, int *firstLen, const char **second, int *secondLen) {
+  TextBufferAccess::segments(b, *first, *firstLen, *second, *secondLen);
+}
+
 void go_fltk_TextBuffer_add_modify_callback(Fl_Text_Buffer *b, uintptr_t handlerId) {
 	b->add_modify_callback(modify_callback_handler, (void*)handlerId);
 }
@@ -59,7 +59,23 @@ type StyleTableEntry struct {
 	Color Color
 	Font  Font
 	Size  int
-}
+	// Attr and BgColor are optional: BgColor is used when Attr has
+	// TEXT_ATTR_BGCOLOR set
+	Attr    TextAttr
+	BgColor Color
+}
+
+type TextAttr uint
+
+const (
+	TEXT_ATTR_BGCOLOR = TextAttr(0x0001)
+	// extend the background color to the end of the line
+	TEXT_ATTR_BGCOLOR_EXT    = TextAttr(0x0003)
+	TEXT_ATTR_UNDERLINE      = TextAttr(0x0004)
+	TEXT_ATTR_GRAMMAR        = TextAttr(0x0008)
+	TEXT_ATTR_SPELLING       = TextAttr(0x000C)
+	TEXT_ATTR_STRIKE_THROUGH = TextAttr(0x0010)
+)
 
 type TextBuffer struct {
 	cPtr       *C.Fl_Text_Buffer
@@ -443,8 +459,8 @@ func (t *TextDisplay) SetHighlightData(buf *TextBuffer, entries []StyleTableEntr
 		colors = append(colors, C.uint(entries[i].Color))
 		fonts = append(fonts, C.int(entries[i].Font))
 		sizes = append(sizes, C.int(entries[i].Size))
-		attrs = append(attrs, 0)
-		bgcolors = append(bgcolors, 0)
+		attrs = append(attrs, C.uint(entries[i].Attr))
+		bgcolors = append(bgcolors, C.uint(entries[i].BgColor))
 	}
 	C.go_fltk_TextDisplay_set_highlight_data((*C.Fl_Text_Display)(t.ptr()), buf.ptr(), &colors[0], &fonts[0], &sizes[0], &attrs[0], &bgcolors[0], C.int(len(entries)))
 }
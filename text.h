@@ -70,6 +70,7 @@ extern "C" {
   extern int go_fltk_TextBuffer_length(Fl_Text_Buffer *b);
   extern const char *go_fltk_TextBuffer_text(Fl_Text_Buffer *b);
   extern const char *go_fltk_TextBuffer_text_range(Fl_Text_Buffer *b, int start, int end);
+  extern void go_fltk_TextBuffer_segments(Fl_Text_Buffer *b, const char **first, int *firstLen, const char **second, int *secondLen);
   extern void go_fltk_TextBuffer_highlight(Fl_Text_Buffer *b, int start, int end);
   extern void go_fltk_TextBuffer_unhighlight(Fl_Text_Buffer *b);
   extern void go_fltk_TextBuffer_replace(Fl_Text_Buffer *b, int start, int end, const char *text);
@@ -2,6 +2,7 @@ package fltk_go
 
 /*
 #include <stdlib.h>
+#include <stdint.h>
 #include "tooltip.h"
 */
 import "C"
@@ -39,3 +40,34 @@ func TooltipEnterArea(wi Widget, x, y, w, h int, tip string) {
 	tooltip = C.CString(tip)
 	C.go_fltk_tooltip_enter_area(wi.getWidget().ptr(), C.int(x), C.int(y), C.int(w), C.int(h), tooltip)
 }
+
+type tooltipProvider func(a, b int, item unsafe.Pointer) string
+
+type tooltipProviderMap struct {
+	providers map[uintptr]tooltipProvider
+	id        uintptr
+}
+
+var globalTooltipProviderMap = &tooltipProviderMap{providers: make(map[uintptr]tooltipProvider)}
+
+func (m *tooltipProviderMap) register(fn tooltipProvider) uintptr {
+	m.id++
+	m.providers[m.id] = fn
+	return m.id
+}
+func (m *tooltipProviderMap) unregister(id uintptr) {
+	delete(m.providers, id)
+}
+
+//export _go_tooltipHandler
+func _go_tooltipHandler(id C.uintptr_t, a, b C.int, item unsafe.Pointer) *C.char {
+	provider, ok := globalTooltipProviderMap.providers[uintptr(id)]
+	if !ok || provider == nil {
+		return nil
+	}
+	text := provider(int(a), int(b), item)
+	if text == "" {
+		return nil
+	}
+	return C.CString(text)
+}
@@ -3,11 +3,87 @@
 #include <FL/Fl_Tree.H>
 
 #include "event_handler.h"
+#include "typeahead.h"
 
-class GTree : public EventHandler<Fl_Tree> {
+class GTree : public EventHandler<TypeAhead<Fl_Tree>> {
 public:
   GTree(int x, int y, int w, int h, const char *label)
-      : EventHandler<Fl_Tree>(x, y, w, h, label) {}
+      : EventHandler<TypeAhead<Fl_Tree>>(x, y, w, h, label) {}
+
+  // indexes the item and the parents that adding it created
+  void item_added(Fl_Tree_Item *item) {
+    if (!typeahead_enabled()) {
+      return;
+    }
+    for (; item && item != root() && !typeahead_indexed(item); item = item->parent()) {
+      typeahead_added(item, key(item));
+    }
+  }
+
+  void item_removing(Fl_Tree_Item *item, bool self) {
+    if (!typeahead_enabled()) {
+      return;
+    }
+    if (self) {
+      typeahead_removed(item);
+    }
+    for (int i = 0; i < item->children(); i++) {
+      item_removing(item->child(i), true);
+    }
+  }
+
+  bool tooltip_item(int &a, int &b, void *&item, int &X, int &Y, int &W, int &H) final {
+    Fl_Tree_Item *i = find_clicked(1);
+    if (!i) {
+      return false;
+    }
+    a = b = 0;
+    item = i;
+    X = i->x(), Y = i->y(), W = i->w(), H = i->h();
+    return true;
+  }
+
+protected:
+  void typeahead_reindex() override {
+    for (Fl_Tree_Item *item = next(root()); item; item = next(item)) {
+      typeahead_added(item, key(item));
+    }
+  }
+
+  bool typeahead_shown(void *data) override {
+    Fl_Tree_Item *item = (Fl_Tree_Item *)data;
+    if (!item->visible_r()) {
+      return false;
+    }
+    for (Fl_Tree_Item *p = item->parent(); p; p = p->parent()) {
+      if (p->is_close()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void *typeahead_current() override {
+    return get_item_focus();
+  }
+
+  void typeahead_jump(void *data) override {
+    Fl_Tree_Item *item = (Fl_Tree_Item *)data;
+    set_item_focus(item);
+    if (selectmode() != FL_TREE_SELECT_NONE) {
+      select_only(item, when());
+    }
+    if (!displayed(item)) {
+      show_item_middle(item);
+    }
+    redraw();
+  }
+
+private:
+  static std::string key(Fl_Tree_Item *item) {
+    const char *label = item->label();
+    return label ? TypeAheadIndex::fold(label, strlen(label)) : std::string();
+  }
 };
 
     
@@ -20,21 +96,47 @@ void go_fltk_Tree_set_show_root(Fl_Tree *tree, int show) {
 }  
 
 Fl_Tree_Item* go_fltk_Tree_add(Fl_Tree *tree, const char *path) {
-  return tree->add(path);
+  Fl_Tree_Item *item = tree->add(path);
+  if (GTree *t = dynamic_cast<GTree*>(tree)) {
+    t->item_added(item);
+  }
+  return item;
 }
 
 int go_fltk_Tree_remove(Fl_Tree *tree, Fl_Tree_Item *item) {
+  if (GTree *t = dynamic_cast<GTree*>(tree)) {
+    t->item_removing(item, true);
+  }
   return tree->remove(item);
 }
 
 void go_fltk_Tree_clear(Fl_Tree *tree) {
   tree->clear();
+  if (GTree *t = dynamic_cast<GTree*>(tree)) {
+    t->typeahead_cleared();
+  }
 }
 
 void go_fltk_Tree_clear_children(Fl_Tree *tree, Fl_Tree_Item *item) {
+  if (GTree *t = dynamic_cast<GTree*>(tree)) {
+    t->item_removing(item, false);
+  }
   tree->clear_children(item);
 }  
 
+void go_fltk_Tree_set_typeahead(Fl_Tree *tree, int enabled) {
+  if (WidgetWithTypeAhead *t = dynamic_cast<WidgetWithTypeAhead*>(tree)) {
+    t->set_typeahead(enabled != 0);
+  }
+}
+
+Fl_Tree_Item* go_fltk_Tree_find_prefix(Fl_Tree *tree, const char *prefix) {
+  if (WidgetWithTypeAhead *t = dynamic_cast<WidgetWithTypeAhead*>(tree)) {
+    return (Fl_Tree_Item *)t->typeahead_find(prefix);
+  }
+  return NULL;
+}
+
 void go_fltk_Tree_Item_set_widget(Fl_Tree_Item *item, Fl_Widget *widget) {
   item->widget(widget);
 }
@@ -29,6 +29,19 @@ type TreeItem struct {
 	ptr *C.Fl_Tree_Item
 }
 
+// SetItemTooltipProvider sets a function computing the tooltip of the item
+// under the mouse. It is called once per hovered item when the tooltip is
+// about to be shown. An empty string shows no tooltip.
+func (t *Tree) SetItemTooltipProvider(provider func(item TreeItem) string) {
+	if provider == nil {
+		t.setTooltipProvider(nil)
+		return
+	}
+	t.setTooltipProvider(func(_, _ int, item unsafe.Pointer) string {
+		return provider(TreeItem{ptr: (*C.Fl_Tree_Item)(item)})
+	})
+}
+
 func (t *Tree) Add(path string) TreeItem {
 	pathStr := C.CString(path)
 	defer C.free(unsafe.Pointer(pathStr))
@@ -45,6 +58,27 @@ func (t *Tree) ClearChildren(item TreeItem) {
 	C.go_fltk_Tree_clear_children((*C.Fl_Tree)(t.ptr()), item.ptr)
 }
 
+// SetTypeAhead enables jumping to the first item starting with the
+// characters typed while the tree has the focus. Only items in open branches
+// are considered. Labels are matched ignoring ASCII case, through an index
+// kept up to date as items are added and removed.
+func (t *Tree) SetTypeAhead(enabled bool) {
+	if enabled {
+		C.go_fltk_Tree_set_typeahead((*C.Fl_Tree)(t.ptr()), 1)
+	} else {
+		C.go_fltk_Tree_set_typeahead((*C.Fl_Tree)(t.ptr()), 0)
+	}
+}
+
+// FindPrefix returns the first displayed item, in alphabetical order, whose
+// label starts with prefix. It requires SetTypeAhead.
+func (t *Tree) FindPrefix(prefix string) (TreeItem, bool) {
+	cPrefix := C.CString(prefix)
+	defer C.free(unsafe.Pointer(cPrefix))
+	item := C.go_fltk_Tree_find_prefix((*C.Fl_Tree)(t.ptr()), cPrefix)
+	return TreeItem{ptr: item}, item != nil
+}
+
 func (t TreeItem) SetWidget(w Widget) {
 	C.go_fltk_Tree_Item_set_widget(t.ptr, w.getWidget().ptr())
 }
@@ -16,6 +16,8 @@ extern "C" {
   extern int go_fltk_Tree_remove(Fl_Tree *tree, Fl_Tree_Item *item);
   extern void go_fltk_Tree_clear(Fl_Tree *tree);
   extern void go_fltk_Tree_clear_children(Fl_Tree* tree, Fl_Tree_Item* item);  
+  extern void go_fltk_Tree_set_typeahead(Fl_Tree* tree, int enabled);
+  extern Fl_Tree_Item* go_fltk_Tree_find_prefix(Fl_Tree* tree, const char* prefix);
 
   extern void go_fltk_Tree_Item_set_widget(Fl_Tree_Item* item, Fl_Widget* widget);
 
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <ctype.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include <FL/Fl.H>
+
+
+// TypeAheadIndex keeps the labels of a widget's items sorted, so that the
+// items starting with a prefix are found in O(log n). Labels are compared
+// with ASCII letters folded to lower case; other bytes, including UTF-8
+// sequences, must match exactly.
+class TypeAheadIndex {
+public:
+  static std::string fold(const char *text, size_t len) {
+    std::string key(text, len);
+    for (size_t i = 0; i < key.size(); i++) {
+      if (!(key[i] & 0x80)) {
+        key[i] = (char)tolower((unsigned char)key[i]);
+      }
+    }
+    return key;
+  }
+
+  void add(void *item, const std::string &key) {
+    remove(item);
+    m_items[item] = m_keys.insert(std::make_pair(key, item));
+  }
+
+  void remove(void *item) {
+    auto it = m_items.find(item);
+    if (it == m_items.end()) {
+      return;
+    }
+    m_keys.erase(it->second);
+    m_items.erase(it);
+  }
+
+  void clear() {
+    m_keys.clear();
+    m_items.clear();
+  }
+
+  bool contains(void *item) const {
+    return m_items.count(item) != 0;
+  }
+
+  // the first item, in label order, that starts with prefix and passes the
+  // filter; if after also matches, the search starts past it and wraps
+  // around, so that repeating a search cycles through the matches
+  template<class F>
+  void *find(const std::string &prefix, void *after, F filter) const {
+    Keys::const_iterator start = m_keys.lower_bound(prefix);
+    auto current = after ? m_items.find(after) : m_items.end();
+    if (current != m_items.end() && matches(current->second, prefix)) {
+      Keys::const_iterator next = current->second;
+      for (++next; next != m_keys.end() && matches(next, prefix); ++next) {
+        if (filter(next->second)) {
+          return next->second;
+        }
+      }
+    }
+    for (Keys::const_iterator it = start; it != m_keys.end() && matches(it, prefix); ++it) {
+      if (filter(it->second)) {
+        return it->second;
+      }
+    }
+    return NULL;
+  }
+
+private:
+  typedef std::multimap<std::string, void *> Keys;
+
+  static bool matches(Keys::const_iterator it, const std::string &prefix) {
+    return it->first.compare(0, prefix.size(), prefix) == 0;
+  }
+
+  Keys m_keys;
+  std::unordered_map<void *, Keys::iterator> m_items;
+};
+
+class WidgetWithTypeAhead {
+public:
+  virtual void set_typeahead(bool enabled) = 0;
+  virtual void *typeahead_find(const char *prefix) = 0;
+};
+
+// TypeAhead jumps to the first item starting with the characters typed in
+// quick succession while the widget has the focus. Typing the same character
+// repeatedly cycles through the items starting with it. The index is only
+// kept while the feature is enabled; the widget classes report their changes
+// through typeahead_added and typeahead_removed and supply the item specific
+// parts below.
+template<class Base>
+class TypeAhead : public Base, public WidgetWithTypeAhead {
+public:
+  template<class... Arg>
+  TypeAhead(Arg... args)
+    : Base(args...) {}
+
+  ~TypeAhead() {
+    Fl::remove_timeout(reset_cb, this);
+  }
+
+  int handle(int event) override {
+    if (event == FL_KEYBOARD && m_enabled && search(Fl::event_text())) {
+      return 1;
+    }
+    return Base::handle(event);
+  }
+
+  void set_typeahead(bool enabled) override {
+    if (enabled == m_enabled) {
+      return;
+    }
+    m_enabled = enabled;
+    m_index.clear();
+    m_typed.clear();
+    if (enabled) {
+      typeahead_reindex();
+    }
+  }
+
+  void *typeahead_find(const char *prefix) override {
+    if (!m_enabled) {
+      return NULL;
+    }
+    const std::string key = TypeAheadIndex::fold(prefix, strlen(prefix));
+    return m_index.find(key, NULL, [this](void *item) { return typeahead_shown(item); });
+  }
+
+  bool typeahead_enabled() const {
+    return m_enabled;
+  }
+
+  void typeahead_added(void *item, const std::string &key) {
+    if (m_enabled) {
+      m_index.add(item, key);
+    }
+  }
+
+  void typeahead_removed(void *item) {
+    if (m_enabled) {
+      m_index.remove(item);
+    }
+  }
+
+  void typeahead_cleared() {
+    m_index.clear();
+  }
+
+  bool typeahead_indexed(void *item) const {
+    return m_index.contains(item);
+  }
+
+protected:
+  // calls typeahead_added for every item of the widget
+  virtual void typeahead_reindex() = 0;
+  // whether the item is currently displayed, not hidden or in a closed branch
+  virtual bool typeahead_shown(void *item) = 0;
+  virtual void *typeahead_current() = 0;
+  virtual void typeahead_jump(void *item) = 0;
+
+private:
+  enum { RESET_DELAY_MS = 1000 };
+
+  bool search(const char *text) {
+    if (!text || !text[0] || (unsigned char)text[0] < ' ' || text[0] == 0x7f ||
+        Fl::event_state(FL_CTRL | FL_ALT | FL_META)) {
+      return false;
+    }
+    // a leading space is left to the widget, which uses it for selecting
+    if (text[0] == ' ' && m_typed.empty()) {
+      return false;
+    }
+    Fl::remove_timeout(reset_cb, this);
+    Fl::add_timeout(RESET_DELAY_MS / 1000.0, reset_cb, this);
+    const std::string key = TypeAheadIndex::fold(text, strlen(text));
+    const bool repeated = key.size() == 1 && !m_typed.empty() &&
+                          m_typed.find_first_not_of(key[0]) == std::string::npos;
+    m_typed += key;
+    auto shown = [this](void *item) { return typeahead_shown(item); };
+    void *item = repeated ? m_index.find(key, typeahead_current(), shown)
+                          : m_index.find(m_typed, NULL, shown);
+    if (item) {
+      typeahead_jump(item);
+    }
+    return true;
+  }
+
+  static void reset_cb(void *data) {
+    static_cast<TypeAhead *>(data)->m_typed.clear();
+  }
+
+  bool m_enabled = false;
+  std::string m_typed;
+  TypeAheadIndex m_index;
+};
@@ -0,0 +1,120 @@
+package fltk_go
+
+import "sync"
+
+// UIBatch collects widget operations from any goroutine and runs them on the
+// UI thread as one unit: Submit wakes the event loop once, and the whole
+// batch then runs in a single awake callback, instead of every update taking
+// the FLTK lock and waking the loop on its own.
+//
+//	batch := fltk_go.NewUIBatch()
+//	for i, row := range rows {
+//		i, row := i, row
+//		batch.Do(func() { labels[i].SetLabel(row) })
+//	}
+//	batch.Submit()
+//
+// As with Awake, Lock must have been called on the UI thread before batches
+// are submitted.
+type UIBatch struct {
+	mu      sync.Mutex
+	ops     []func()
+	redraws []*widget
+}
+
+func NewUIBatch() *UIBatch {
+	return &UIBatch{}
+}
+
+// Do records fn to run on the UI thread.
+func (b *UIBatch) Do(fn func()) {
+	b.mu.Lock()
+	b.ops = append(b.ops, fn)
+	b.mu.Unlock()
+}
+
+// Redraw schedules a redraw of the widget after the batch's operations.
+// Each widget is redrawn once per batch however often it is recorded, and
+// widgets destroyed in the meantime are skipped.
+func (b *UIBatch) Redraw(w Widget) {
+	b.mu.Lock()
+	b.redraws = append(b.redraws, w.getWidget())
+	b.mu.Unlock()
+}
+
+// Len returns the number of recorded operations, redraws included.
+func (b *UIBatch) Len() int {
+	b.mu.Lock()
+	defer b.mu.Unlock()
+	return len(b.ops) + len(b.redraws)
+}
+
+// Submit hands the recorded operations to the UI thread and empties the
+// batch, which can be filled again right away. It returns false if the
+// event loop could not be woken, in which case the operations stay in the
+// batch, ahead of any recorded since, for a later Submit.
+func (b *UIBatch) Submit() bool {
+	b.mu.Lock()
+	ops, redraws := b.ops, b.redraws
+	b.ops, b.redraws = nil, nil
+	b.mu.Unlock()
+	if len(ops) == 0 && len(redraws) == 0 {
+		return true
+	}
+	if Awake(func() {
+		runBatch(ops, redraws)
+	}) {
+		return true
+	}
+	b.mu.Lock()
+	b.ops = append(ops, b.ops...)
+	b.redraws = append(redraws, b.redraws...)
+	b.mu.Unlock()
+	return false
+}
+
+func runBatch(ops []func(), redraws []*widget) {
+	for _, op := range ops {
+		op()
+	}
+	seen := make(map[*widget]bool, len(redraws))
+	for _, w := range redraws {
+		if !seen[w] && w.exists() {
+			seen[w] = true
+			w.Redraw()
+		}
+	}
+}
+
+var uiQueue struct {
+	mu      sync.Mutex
+	ops     []func()
+	pending bool
+}
+
+// RunOnUI runs fn on the UI thread. Unlike Awake, calls made before the UI
+// thread got to run the previous ones share one wakeup: a goroutine
+// streaming many small updates wakes the event loop about once per loop
+// iteration rather than once per update.
+func RunOnUI(fn func()) {
+	uiQueue.mu.Lock()
+	uiQueue.ops = append(uiQueue.ops, fn)
+	wake := !uiQueue.pending
+	uiQueue.pending = true
+	uiQueue.mu.Unlock()
+	if wake && !Awake(drainUIQueue) {
+		// let the next call try again
+		uiQueue.mu.Lock()
+		uiQueue.pending = false
+		uiQueue.mu.Unlock()
+	}
+}
+
+func drainUIQueue() {
+	uiQueue.mu.Lock()
+	ops := uiQueue.ops
+	uiQueue.ops = nil
+	uiQueue.pending = false
+	uiQueue.mu.Unlock()
+	runBatch(ops, nil)
+}
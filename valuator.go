@@ -28,3 +28,11 @@ func (v *valuator) Value() float64 {
 func (v *valuator) SetValue(value float64) {
 	C.go_fltk_Valuator_set_value((*C.Fl_Valuator)(v.ptr()), C.double(value))
 }
+
+// SetCallbackCoalescing makes the callback fire at most once per frame while
+// the value is changing (e.g. during a drag with WhenChanged), with the latest
+// value. A pending callback is delivered immediately when the mouse button is
+// released, so the final value is never lost.
+func (v *valuator) SetCallbackCoalescing(enabled bool) {
+	v.setCallbackCoalescing(enabled)
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cmath>
+
+#include <FL/Fl.H>
+#include <FL/Fl_Group.H>
+
+
+enum WheelScrollMode {
+  // every FL_MOUSEWHEEL event is handled by the widget as it arrives
+  WHEEL_SCROLL_IMMEDIATE = 0,
+  // wheel deltas are summed up and applied once per frame
+  WHEEL_SCROLL_COALESCED = 1,
+  // like WHEEL_SCROLL_COALESCED, but the offset glides to its target
+  WHEEL_SCROLL_SMOOTH = 2,
+};
+
+class WidgetWithWheelScroll {
+public:
+  virtual void set_wheel_scroll_mode(int mode, double step) = 0;
+};
+
+// WheelScroll merges the FL_MOUSEWHEEL event storm produced by fast trackpad
+// scrolling into a single scroll offset update (and therefore a single
+// repaint) per frame.  The position is tracked as a double, so wheel steps
+// that are not a whole number of pixels accumulate instead of being rounded
+// away on every event.  Children under the mouse still get the wheel events
+// first, and only the ones the widget would scroll by itself are merged.
+//
+// Derived classes describe how to read, clamp and apply the scroll offset.
+template<class BaseWidget>
+class WheelScroll : public BaseWidget, public WidgetWithWheelScroll {
+public:
+  template<class... Arg>
+  WheelScroll(Arg... args)
+    : BaseWidget(args...) {}
+
+  virtual ~WheelScroll() {
+    Fl::remove_timeout(frame_cb, this);
+  }
+
+  int handle(int event) override {
+    if (event != FL_MOUSEWHEEL || m_mode == WHEEL_SCROLL_IMMEDIATE) {
+      return BaseWidget::handle(event);
+    }
+    const int dx = Fl::event_dx(), dy = Fl::event_dy();
+    if ((dx == 0 && dy == 0) || !Fl::event_inside(this)) {
+      return BaseWidget::handle(event);
+    }
+    // children under the mouse get the event first, as in Fl_Group
+    switch (offer_to_children()) {
+    case CHILD_TOOK:
+      return 1;
+    case CHILD_UNKNOWN:
+      return BaseWidget::handle(event);
+    case CHILD_NONE:
+      break;
+    }
+    if (!m_pending) {
+      // the fraction left over by the last frame is kept unless the offset
+      // was changed from elsewhere since
+      int x = 0, y = 0;
+      wheel_position(x, y);
+      if (x != std::lround(m_currentX)) {
+        m_targetX = m_currentX = x;
+      }
+      if (y != std::lround(m_currentY)) {
+        m_targetY = m_currentY = y;
+      }
+      m_pending = true;
+      Fl::add_timeout(FRAME_TIME, frame_cb, this);
+    }
+    const double step = m_step > 0 ? m_step : wheel_line_size();
+    m_targetX += dx * step;
+    m_targetY += dy * step;
+    return 1;
+  }
+
+  void set_wheel_scroll_mode(int mode, double step) final {
+    m_mode = mode;
+    m_step = step;
+    if (m_mode == WHEEL_SCROLL_IMMEDIATE && m_pending) {
+      Fl::remove_timeout(frame_cb, this);
+      m_pending = false;
+    }
+  }
+
+protected:
+  // current scroll offset in pixels
+  virtual void wheel_position(int &x, int &y) = 0;
+  // allowed range of the scroll offset in pixels
+  virtual void wheel_limits(int &minX, int &minY, int &maxX, int &maxY) = 0;
+  // moves the content to the given offset and schedules a redraw
+  virtual void wheel_scroll_to(int x, int y) = 0;
+  // number of pixels scrolled for a single wheel notch when no step is set
+  virtual double wheel_line_size() { return 16; }
+  // whether the child is one of the widget's own scrollbars, which the
+  // wheel events are not offered to
+  virtual bool wheel_scrollbar(Fl_Widget *child) = 0;
+
+private:
+  enum ChildWheel { CHILD_NONE, CHILD_TOOK, CHILD_UNKNOWN };
+
+  // offers the event to the children under the mouse, last first; events
+  // for subwindows need their coordinates translated, which only Fl_Group
+  // does, so their fate is unknown
+  ChildWheel offer_to_children() {
+    Fl_Group *group = this->as_group();
+    if (!group) {
+      return CHILD_NONE;
+    }
+    for (int i = group->children(); i--;) {
+      Fl_Widget *child = group->child(i);
+      if (!child->takesevents() || !Fl::event_inside(child) || wheel_scrollbar(child)) {
+        continue;
+      }
+      if (child->as_window()) {
+        return CHILD_UNKNOWN;
+      }
+      if (child->handle(FL_MOUSEWHEEL)) {
+        return CHILD_TOOK;
+      }
+    }
+    return CHILD_NONE;
+  }
+
+  static constexpr double FRAME_TIME = 1.0 / 60.0;
+  // portion of the remaining distance covered in each frame of a smooth scroll
+  static constexpr double SMOOTH_FACTOR = 0.35;
+
+  static void frame_cb(void *data) {
+    static_cast<WheelScroll*>(data)->frame();
+  }
+
+  static double clamp(double v, int lo, int hi) {
+    if (lo > hi) {
+      const int t = lo; lo = hi; hi = t;
+    }
+    return v < lo ? lo : (v > hi ? hi : v);
+  }
+
+  void frame() {
+    int minX = 0, minY = 0, maxX = 0, maxY = 0;
+    wheel_limits(minX, minY, maxX, maxY);
+    m_targetX = clamp(m_targetX, minX, maxX);
+    m_targetY = clamp(m_targetY, minY, maxY);
+
+    bool done = true;
+    if (m_mode == WHEEL_SCROLL_SMOOTH) {
+      m_currentX += (m_targetX - m_currentX) * SMOOTH_FACTOR;
+      m_currentY += (m_targetY - m_currentY) * SMOOTH_FACTOR;
+      if (std::fabs(m_targetX - m_currentX) < 0.5 && std::fabs(m_targetY - m_currentY) < 0.5) {
+        m_currentX = m_targetX;
+        m_currentY = m_targetY;
+      } else {
+        done = false;
+      }
+    } else {
+      m_currentX = m_targetX;
+      m_currentY = m_targetY;
+    }
+
+    int x = 0, y = 0;
+    wheel_position(x, y);
+    const int newX = (int)std::lround(m_currentX), newY = (int)std::lround(m_currentY);
+    if (newX != x || newY != y) {
+      wheel_scroll_to(newX, newY);
+    }
+
+    if (done) {
+      m_pending = false;
+    } else {
+      Fl::repeat_timeout(FRAME_TIME, frame_cb, this);
+    }
+  }
+
+  int m_mode = WHEEL_SCROLL_IMMEDIATE;
+  double m_step = 0;
+  bool m_pending = false;
+  double m_currentX = 0, m_currentY = 0;
+  double m_targetX = 0, m_targetY = 0;
+};
@@ -3,9 +3,11 @@
 #include <FL/Fl.H>
 #include <FL/Fl_Widget.H>
 
+#include "callback_coalescing.h"
 #include "callbacks.h"
 #include "enumerations.h"
 #include "event_handler.h"
+#include "widget_handle.h"
 
 
 Fl_Widget_Tracker* go_fltk_new_Widget_Tracker(Fl_Widget* w) {
@@ -20,6 +22,16 @@ int go_fltk_Widget_Tracker_exists(Fl_Widget_Tracker* t) {
 void go_fltk_Widget_Tracker_delete(Fl_Widget_Tracker* t) {
   delete t;
 }
+uint64_t go_fltk_Widget_handle(Fl_Widget* w) {
+  WidgetWithHandle* wh = dynamic_cast<WidgetWithHandle*>(w);
+  if (wh == nullptr) {
+    return 0;
+  }
+  return wh->widget_handle();
+}
+Fl_Widget* go_fltk_Widget_from_handle(uint64_t handle) {
+  return WidgetHandles::instance().get(handle);
+}
 
 void go_fltk_delete_widget(Fl_Widget *w) {
   Fl::delete_widget(w);
@@ -28,7 +40,20 @@ void go_fltk_Widget_set_box(Fl_Widget *w, int box) {
   w->box((Fl_Boxtype)box);
 }
 void go_fltk_Widget_set_callback(Fl_Widget *w, uintptr_t id) {
-  w->callback(callback_handler, (void*)id);
+  WidgetWithCallbackCoalescing* wc = dynamic_cast<WidgetWithCallbackCoalescing*>(w);
+  if (wc != nullptr && wc->callback_coalescing()) {
+    w->callback(coalescing_callback_handler, (void*)id);
+  } else {
+    w->callback(callback_handler, (void*)id);
+  }
+}
+int go_fltk_Widget_set_callback_coalescing(Fl_Widget* w, int enabled) {
+  WidgetWithCallbackCoalescing* wc = dynamic_cast<WidgetWithCallbackCoalescing*>(w);
+  if (wc == nullptr) {
+    return 0;
+  }
+  wc->set_callback_coalescing(enabled);
+  return 1;
 }
 int go_fltk_Widget_add_deletion_handler(Fl_Widget* w, uintptr_t id) {
   WidgetWithDeletionHandler* wh = dynamic_cast<WidgetWithDeletionHandler*>(w);
@@ -65,6 +90,14 @@ int go_fltk_Widget_set_draw_handler(Fl_Widget* w, uintptr_t id) {
   wh->set_draw_handler(id);
   return 1;
 }
+int go_fltk_Widget_set_tooltip_provider(Fl_Widget* w, uintptr_t id) {
+  WidgetWithTooltipProvider* wh = dynamic_cast<WidgetWithTooltipProvider*>(w);
+  if (wh == nullptr) {
+    return 0;
+  }
+  wh->set_tooltip_provider(id);
+  return 1;
+}
 void go_fltk_Widget_draw(Fl_Widget *w) { w->draw(); }
 void go_fltk_Widget_basedraw(Fl_Widget *w) {
   WidgetWithDrawHandler* wh = dynamic_cast<WidgetWithDrawHandler*>(w);
@@ -11,12 +11,17 @@ import (
 )
 
 type widget struct {
-	tracker           *C.Fl_Widget_Tracker
-	callbackId        uintptr
-	deletionHandlerId uintptr
-	resizeHandlerId   uintptr
-	drawHandlerId     uintptr
-	eventHandlerId    int
+	// widgets created by this package are looked up by handle; others,
+	// such as the parts of some composite widgets, by a tracker
+	handle                  C.uint64_t
+	tracker                 *C.Fl_Widget_Tracker
+	callbackId              uintptr
+	deletionHandlerId       uintptr
+	resizeHandlerId         uintptr
+	drawHandlerId           uintptr
+	eventHandlerId          int
+	delegatedEventHandlerId int
+	tooltipProviderId       uintptr
 }
 
 type Widget interface {
@@ -25,30 +30,53 @@ type Widget interface {
 
 var ErrDestroyed = errors.New("widget is destroyed")
 
+// WidgetHandle identifies a widget to the delegated event handler of a
+// Group. A handle kept after its widget is destroyed does not name the
+// widgets created later.
+type WidgetHandle uint64
+
 func initWidget(iw Widget, p unsafe.Pointer) {
 	w := iw.getWidget()
-	w.tracker = C.go_fltk_new_Widget_Tracker((*C.Fl_Widget)(p))
+	w.track((*C.Fl_Widget)(p))
 	w.deletionHandlerId = w.addDeletionHandler(w.onDelete)
 }
 func initUnownedWidget(iw Widget, p unsafe.Pointer) {
 	w := iw.getWidget()
-	w.tracker = C.go_fltk_new_Widget_Tracker((*C.Fl_Widget)(p))
+	w.track((*C.Fl_Widget)(p))
+}
+
+func (w *widget) track(p *C.Fl_Widget) {
+	if w.handle = C.go_fltk_Widget_handle(p); w.handle == 0 {
+		w.tracker = C.go_fltk_new_Widget_Tracker(p)
+	}
 }
 
 func (w *widget) getWidget() *widget {
 	return w
 }
 func (w *widget) ptr() *C.Fl_Widget {
-	if !w.exists() {
+	p := w.lookup()
+	if p == nil {
 		panic(ErrDestroyed)
 	}
-	return C.go_fltk_Widget_Tracker_widget(w.tracker)
+	return p
 }
 func (w *widget) exists() bool {
-	if w.tracker == nil {
-		return false
+	return w.lookup() != nil
+}
+
+// Exists reports whether the widget has not been destroyed yet.
+func (w *widget) Exists() bool {
+	return w.exists()
+}
+func (w *widget) lookup() *C.Fl_Widget {
+	if w.handle != 0 {
+		return C.go_fltk_Widget_from_handle(w.handle)
+	}
+	if w.tracker == nil || C.go_fltk_Widget_Tracker_exists(w.tracker) == 0 {
+		return nil
 	}
-	return C.go_fltk_Widget_Tracker_exists(w.tracker) == 1
+	return C.go_fltk_Widget_Tracker_widget(w.tracker)
 }
 func (w *widget) addDeletionHandler(handler func()) uintptr {
 	deletionHandlerId := globalCallbackMap.register(handler)
@@ -64,6 +92,15 @@ func (w *widget) SetCallback(f func()) {
 	w.callbackId = globalCallbackMap.register(f)
 	C.go_fltk_Widget_set_callback(w.ptr(), C.uintptr_t(w.callbackId))
 }
+func (w *widget) setCallbackCoalescing(enabled bool) {
+	e := 0
+	if enabled {
+		e = 1
+	}
+	if C.go_fltk_Widget_set_callback_coalescing(w.ptr(), C.int(e)) == 0 {
+		panic("this widget does not support callback coalescing")
+	}
+}
 func (w *widget) SetCallbackCondition(when CallbackCondition) {
 	C.go_fltk_Widget_when(w.ptr(), C.int(when))
 }
@@ -76,6 +113,14 @@ func (w *widget) SetEventHandler(handler func(Event) bool) {
 		panic("this widget does not support event handling")
 	}
 }
+
+// Handle returns the handle identifying the widget to delegated event
+// handlers, or 0 for the widgets without one, such as the parts of some
+// composite widgets, whose events are not delegated.
+func (w *widget) Handle() WidgetHandle {
+	w.ptr()
+	return WidgetHandle(w.handle)
+}
 func (w *widget) SetResizeHandler(handler func()) {
 	if w.resizeHandlerId > 0 {
 		globalCallbackMap.unregister(w.resizeHandlerId)
@@ -99,6 +144,30 @@ func (w *widget) SetDrawHandler(handler func(func())) {
 	}
 }
 
+func (w *widget) setTooltipProvider(provider tooltipProvider) {
+	if w.tooltipProviderId > 0 {
+		globalTooltipProviderMap.unregister(w.tooltipProviderId)
+		w.tooltipProviderId = 0
+	}
+	if provider != nil {
+		w.tooltipProviderId = globalTooltipProviderMap.register(provider)
+	}
+	if C.go_fltk_Widget_set_tooltip_provider(w.ptr(), C.uintptr_t(w.tooltipProviderId)) == 0 {
+		panic("this widget does not support tooltip providers")
+	}
+}
+
+// SetTooltipProvider sets a function computing the widget's tooltip. It is
+// called only when the tooltip is about to be shown; an empty string shows
+// no tooltip. A nil function removes the provider.
+func (w *widget) SetTooltipProvider(provider func() string) {
+	if provider == nil {
+		w.setTooltipProvider(nil)
+		return
+	}
+	w.setTooltipProvider(func(int, int, unsafe.Pointer) string { return provider() })
+}
+
 func (w *widget) onDelete() {
 	if w.deletionHandlerId > 0 {
 		globalCallbackMap.unregister(w.deletionHandlerId)
@@ -120,7 +189,18 @@ func (w *widget) onDelete() {
 		globalEventHandlerMap.unregister(w.eventHandlerId)
 	}
 	w.eventHandlerId = 0
-	C.go_fltk_Widget_Tracker_delete(w.tracker)
+	if w.delegatedEventHandlerId > 0 {
+		globalDelegatedEventHandlerMap.unregister(w.delegatedEventHandlerId)
+	}
+	w.delegatedEventHandlerId = 0
+	if w.tooltipProviderId > 0 {
+		globalTooltipProviderMap.unregister(w.tooltipProviderId)
+	}
+	w.tooltipProviderId = 0
+	w.handle = 0
+	if w.tracker != nil {
+		C.go_fltk_Widget_Tracker_delete(w.tracker)
+	}
 	w.tracker = nil
 }
 func (w *widget) Destroy() {
@@ -140,6 +220,10 @@ func (w *widget) Destroy() {
 		globalEventHandlerMap.unregister(w.eventHandlerId)
 	}
 	w.eventHandlerId = 0
+	if w.delegatedEventHandlerId > 0 {
+		globalDelegatedEventHandlerMap.unregister(w.delegatedEventHandlerId)
+	}
+	w.delegatedEventHandlerId = 0
 	C.go_fltk_delete_widget(w.ptr())
 }
 
@@ -16,6 +16,8 @@ extern "C" {
   extern Fl_Widget* go_fltk_Widget_Tracker_widget(Fl_Widget_Tracker* t);
   extern void go_fltk_Widget_Tracker_delete(Fl_Widget_Tracker* t);
   extern int go_fltk_Widget_Tracker_exists(Fl_Widget_Tracker* t);
+  extern uint64_t go_fltk_Widget_handle(Fl_Widget* w);
+  extern Fl_Widget* go_fltk_Widget_from_handle(uint64_t handle);
   extern void go_fltk_delete_widget(Fl_Widget *w);
   extern void go_fltk_Widget_set_box(Fl_Widget *w, int box);
   extern void go_fltk_Widget_set_labelfont(Fl_Widget *w, int font);
@@ -24,8 +26,10 @@ extern "C" {
   extern void go_fltk_Widget_set_labelcolor(Fl_Widget *w, unsigned int tcol);
   extern void go_fltk_Widget_clear_visible_focus(Fl_Widget *w);
   extern void go_fltk_Widget_set_callback(Fl_Widget *w, uintptr_t id);
+  extern int go_fltk_Widget_set_callback_coalescing(Fl_Widget *w, int enabled);
   extern int go_fltk_Widget_set_resize_handler(Fl_Widget* w, uintptr_t id);
   extern int go_fltk_Widget_set_draw_handler(Fl_Widget *w, uintptr_t id);
+  extern int go_fltk_Widget_set_tooltip_provider(Fl_Widget *w, uintptr_t id);
   extern void go_fltk_Widget_draw(Fl_Widget *w);
   // calls draw() on the widget ignoring potentially specified draw handlers.  
   extern void go_fltk_Widget_basedraw(Fl_Widget* w);
@@ -0,0 +1,53 @@
+package fltk_go
+
+import (
+	"strconv"
+	"testing"
+)
+
+// Creating and destroying many widgets used to be quadratic, as every
+// widget was watched by an Fl_Widget_Tracker.
+func BenchmarkCreateDestroyWidgets(b *testing.B) {
+	for _, n := range []int{10000, 50000, 200000} {
+		b.Run(strconv.Itoa(n), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				win := NewWindow(400, 400)
+				boxes := make([]*Box, n)
+				for j := range boxes {
+					boxes[j] = NewBox(NO_BOX, 0, 0, 10, 10)
+				}
+				win.End()
+				win.Destroy()
+				Wait(0)
+				if boxes[0].exists() {
+					b.Fatal("box not destroyed")
+				}
+			}
+		})
+	}
+}
+
+// Getting and putting back pooled widgets allocates nothing once the pool
+// holds enough of them.
+func BenchmarkWidgetPool(b *testing.B) {
+	win := NewWindow(400, 400)
+	win.End()
+	pool := NewWidgetPool(func() *Box {
+		return NewBox(NO_BOX, 0, 0, 10, 10)
+	}, nil)
+	boxes := make([]*Box, 1000)
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		for j := range boxes {
+			boxes[j] = pool.Get()
+			win.Add(boxes[j])
+		}
+		for _, box := range boxes {
+			pool.Put(box)
+		}
+	}
+	b.StopTimer()
+	pool.Clear()
+	win.Destroy()
+	Wait(0)
+}
@@ -10,6 +10,9 @@ func testWidgetDestroyed(name string, w Widget, t *testing.T) {
 	if ww.tracker != nil {
 		t.Errorf("%s's widget's tracker is not nil", name)
 	}
+	if ww.handle != 0 {
+		t.Errorf("%s's widget's handle is not 0", name)
+	}
 	if ww.callbackId != 0 {
 		t.Errorf("%s's callbackId is not 0", name)
 	}
@@ -32,6 +35,10 @@ func testGlobalMapsEmpty(t *testing.T) {
 		t.Errorf("Global event handler map is not empty: %d", globalEventHandlerMap.size())
 	}
 	globalEventHandlerMap.clear()
+	if !globalDelegatedEventHandlerMap.isEmpty() {
+		t.Errorf("Global delegated event handler map is not empty: %d", globalDelegatedEventHandlerMap.size())
+	}
+	globalDelegatedEventHandlerMap.clear()
 	if !globalTableCallbackMap.isEmpty() {
 		t.Errorf("Global table callback map is not empty: %d", globalTableCallbackMap.size())
 	}
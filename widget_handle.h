@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+class Fl_Widget;
+
+
+// WidgetHandles tells Go whether the widgets it wraps still exist. A handle
+// names a slot holding the widget and the generation of the slot, which is
+// bumped when the widget is destroyed so that stale handles find nothing.
+// Creating, looking up and releasing a handle is O(1), whereas
+// Fl_Widget_Tracker is found by a linear search on every creation and on
+// every widget deletion.
+class WidgetHandles {
+public:
+  static WidgetHandles &instance() {
+    static WidgetHandles handles;
+    return handles;
+  }
+
+  uint64_t acquire(Fl_Widget *widget) {
+    uint32_t index;
+    if (m_free.empty()) {
+      index = (uint32_t)m_slots.size();
+      m_slots.push_back(Slot());
+    } else {
+      index = m_free.back();
+      m_free.pop_back();
+    }
+    m_slots[index].widget = widget;
+    return (uint64_t)m_slots[index].generation << 32 | index;
+  }
+
+  void release(uint64_t handle) {
+    const uint32_t index = (uint32_t)handle;
+    if (get(handle) == NULL) {
+      return;
+    }
+    Slot &slot = m_slots[index];
+    slot.widget = NULL;
+    // 0 is never a generation, so that 0 is never a handle
+    if (++slot.generation == 0) {
+      slot.generation = 1;
+    }
+    m_free.push_back(index);
+  }
+
+  Fl_Widget *get(uint64_t handle) const {
+    const uint32_t index = (uint32_t)handle;
+    if (index >= m_slots.size() || m_slots[index].generation != (uint32_t)(handle >> 32)) {
+      return NULL;
+    }
+    return m_slots[index].widget;
+  }
+
+private:
+  struct Slot {
+    Fl_Widget *widget = NULL;
+    uint32_t generation = 1;
+  };
+
+  std::vector<Slot> m_slots;
+  std::vector<uint32_t> m_free;
+};
@@ -0,0 +1,131 @@
+package fltk_go
+
+/*
+#include "group.h"
+#include "widget.h"
+*/
+import "C"
+
+// WidgetPool keeps widgets of one type that are no longer needed so that
+// they can be used again instead of being destroyed and created anew, which
+// suits popups, transient rows and notifications. A widget comes back from
+// the pool with its Go value, its callbacks and its handlers, so handlers
+// should be set once when the pool creates the widget, and the state of
+// each use restored by the reset function.
+//
+// Widgets destroyed while in use or in the pool are dropped from it.
+type WidgetPool[T Widget] struct {
+	create func() T
+	reset  func(T)
+	idle   []T
+	// the idle widgets kept at most, 0 for no limit
+	maxIdle int
+	stats   WidgetPoolStats
+}
+
+// WidgetPoolStats counts what a WidgetPool did.
+type WidgetPoolStats struct {
+	// widgets created by Get because the pool was empty
+	Created int
+	// widgets returned by Get from the pool
+	Reused int
+	// widgets given back to the pool by Put
+	Released int
+	// widgets destroyed by the pool because it was full or cleared
+	Destroyed int
+	// widgets in the pool
+	Idle int
+}
+
+// NewWidgetPool returns a pool creating its widgets with create, which
+// should end any group it begins. reset, which may be nil, is called on a
+// widget when it is taken from the pool.
+func NewWidgetPool[T Widget](create func() T, reset func(T)) *WidgetPool[T] {
+	return &WidgetPool[T]{create: create, reset: reset}
+}
+
+// SetMaxIdle sets how many widgets the pool keeps at most; the ones given
+// back beyond that are destroyed. 0, the default, keeps them all.
+func (p *WidgetPool[T]) SetMaxIdle(n int) {
+	p.maxIdle = n
+	for p.maxIdle > 0 && len(p.idle) > p.maxIdle {
+		p.destroy(p.pop())
+	}
+}
+
+// Get returns a visible widget outside of any group, taken from the pool and
+// reset if there is one, created otherwise.
+func (p *WidgetPool[T]) Get() T {
+	for len(p.idle) > 0 {
+		w := p.pop()
+		if !w.getWidget().exists() {
+			continue
+		}
+		p.stats.Reused++
+		if p.reset != nil {
+			p.reset(w)
+		}
+		w.getWidget().Show()
+		return w
+	}
+	p.stats.Created++
+	w := p.create()
+	if parent := C.go_fltk_Widget_parent(w.getWidget().ptr()); parent != nil {
+		C.go_fltk_Group_remove(parent, w.getWidget().ptr())
+	}
+	return w
+}
+
+// Put hides the widget, removes it from its group and keeps it for a later
+// Get, or destroys it if the pool is full.
+func (p *WidgetPool[T]) Put(w T) {
+	ww := w.getWidget()
+	if !ww.exists() {
+		return
+	}
+	p.stats.Released++
+	if p.maxIdle > 0 && len(p.idle) >= p.maxIdle {
+		p.destroy(w)
+		return
+	}
+	ww.Hide()
+	if parent := C.go_fltk_Widget_parent(ww.ptr()); parent != nil {
+		C.go_fltk_Group_remove(parent, ww.ptr())
+	}
+	p.idle = append(p.idle, w)
+}
+
+// Clear destroys the widgets in the pool.
+func (p *WidgetPool[T]) Clear() {
+	for len(p.idle) > 0 {
+		p.destroy(p.pop())
+	}
+}
+
+// Stats returns what the pool did so far.
+func (p *WidgetPool[T]) Stats() WidgetPoolStats {
+	stats := p.stats
+	stats.Idle = len(p.idle)
+	return stats
+}
+
+func (p *WidgetPool[T]) pop() T {
+	var zero T
+	w := p.idle[len(p.idle)-1]
+	p.idle[len(p.idle)-1] = zero
+	p.idle = p.idle[:len(p.idle)-1]
+	return w
+}
+
+func (p *WidgetPool[T]) destroy(w T) {
+	if !w.getWidget().exists() {
+		return
+	}
+	p.stats.Destroyed++
+	// some widgets clean up more than widget.Destroy
+	if d, ok := any(w).(interface{ Destroy() }); ok {
+		d.Destroy()
+	} else {
+		w.getWidget().Destroy()
+	}
+}
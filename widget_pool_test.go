@@ -0,0 +1,50 @@
+package fltk_go
+
+import (
+	"testing"
+)
+
+func TestWidgetPool(t *testing.T) {
+	win := NewWindow(400, 400)
+	win.End()
+	resets := 0
+	pool := NewWidgetPool(func() *Box {
+		return NewBox(FLAT_BOX, 0, 0, 10, 10)
+	}, func(*Box) {
+		resets++
+	})
+
+	a := pool.Get()
+	win.Add(a)
+	pool.Put(a)
+	if a.Parent().exists() {
+		t.Errorf("pooled widget is still in its group")
+	}
+	if b := pool.Get(); b != a {
+		t.Errorf("pool did not reuse its widget")
+	}
+	if !a.Visible() {
+		t.Errorf("reused widget is hidden")
+	}
+	b := pool.Get()
+	pool.SetMaxIdle(1)
+	pool.Put(a)
+	pool.Put(b)
+	Wait(0)
+	if b.exists() {
+		t.Errorf("widget put in a full pool is not destroyed")
+	}
+	testWidgetDestroyed("box", b, t)
+	want := WidgetPoolStats{Created: 2, Reused: 1, Released: 3, Destroyed: 1, Idle: 1}
+	if stats := pool.Stats(); stats != want || resets != 1 {
+		t.Errorf("unexpected stats %+v, %d resets", stats, resets)
+	}
+
+	pool.Clear()
+	Wait(0)
+	if a.exists() || pool.Stats().Idle != 0 {
+		t.Errorf("cleared pool kept its widget")
+	}
+	win.Destroy()
+	Wait(0)
+}
@@ -0,0 +1,51 @@
+#include "widget_surface.h"
+
+#include <cmath>
+
+#include <FL/Fl_Image.H>
+#include <FL/Fl_Image_Surface.H>
+#include <FL/Fl_Widget.H>
+#include <FL/Fl_Window.H>
+#include <FL/fl_draw.H>
+#include <FL/platform.H>
+
+
+// Draws the widget and its children into an offscreen image, without the
+// widget's window having to be shown.  scale multiplies the pixel size of the
+// result, so that e.g. 2 renders at twice the widget's resolution.
+Fl_RGB_Image *go_fltk_render_widget(Fl_Widget *w, double scale) {
+  if (scale <= 0 || w->w() <= 0 || w->h() <= 0) {
+    return nullptr;
+  }
+  fl_open_display();
+  const int W = (int)std::ceil(w->w() * scale), H = (int)std::ceil(w->h() * scale);
+  Fl_Image_Surface surface(W, H);
+  Fl_Surface_Device::push_current(&surface);
+  surface.driver()->scale((float)scale);
+  fl_color(w->color());
+  fl_rectf(0, 0, w->w(), w->h());
+  // windows are invisible until shown, which would make the surface skip them
+  const bool hidden = w->as_window() && !w->visible();
+  if (hidden) {
+    w->set_visible();
+  }
+  surface.draw(w, 0, 0);
+  if (hidden) {
+    w->clear_visible();
+  }
+  Fl_RGB_Image *img = surface.image();
+  Fl_Surface_Device::pop_current();
+  return img;
+}
+
+const unsigned char *go_fltk_rendered_pixels(Fl_RGB_Image *img, int *w, int *h, int *d, int *ld) {
+  *w = img->data_w();
+  *h = img->data_h();
+  *d = img->d();
+  *ld = img->ld() ? img->ld() : img->data_w() * img->d();
+  return (const unsigned char *)img->data()[0];
+}
+
+void go_fltk_rendered_delete(Fl_RGB_Image *img) {
+  delete img;
+}
@@ -0,0 +1,75 @@
+package fltk_go
+
+/*
+#include "widget_surface.h"
+*/
+import "C"
+import (
+	"errors"
+	"io"
+	"unsafe"
+)
+
+var ErrRenderFailed = errors.New("widget could not be rendered")
+
+// WidgetRenderer draws widgets into memory without showing them, for example
+// to export dashboards as images from batch jobs. The pixel buffer is reused
+// between calls to Render, so rendering many widgets does not allocate for
+// each of them.
+type WidgetRenderer struct {
+	scale  float64
+	pix    []byte
+	width  int
+	height int
+}
+
+// NewWidgetRenderer creates a renderer producing images with scale pixels per
+// widget unit.
+func NewWidgetRenderer(scale float64) *WidgetRenderer {
+	return &WidgetRenderer{scale: scale}
+}
+
+// Render draws the widget and its children. It must be called on the UI
+// thread; the result is available through Pixels and EncodePNG.
+func (r *WidgetRenderer) Render(w Widget) error {
+	img := C.go_fltk_render_widget(w.getWidget().ptr(), C.double(r.scale))
+	if img == nil {
+		return ErrRenderFailed
+	}
+	defer C.go_fltk_rendered_delete(img)
+	var cw, ch, cd, cld C.int
+	data := C.go_fltk_rendered_pixels(img, &cw, &ch, &cd, &cld)
+	width, height, depth, ld := int(cw), int(ch), int(cd), int(cld)
+	if data == nil || depth < 3 {
+		return ErrRenderFailed
+	}
+	src := unsafe.Slice((*byte)(unsafe.Pointer(data)), ld*height)
+	if cap(r.pix) < width*height*3 {
+		r.pix = make([]byte, width*height*3)
+	}
+	r.pix = r.pix[:width*height*3]
+	for y := 0; y < height; y++ {
+		row := src[y*ld:]
+		dst := r.pix[y*width*3 : (y+1)*width*3]
+		if depth == 3 {
+			copy(dst, row[:width*3])
+			continue
+		}
+		for x := 0; x < width; x++ {
+			copy(dst[x*3:x*3+3], row[x*depth:x*depth+3])
+		}
+	}
+	r.width, r.height = width, height
+	return nil
+}
+
+// Pixels returns the last rendered image as packed RGB rows. The slice is
+// overwritten by the next call to Render.
+func (r *WidgetRenderer) Pixels() (pix []byte, width, height int) {
+	return r.pix, r.width, r.height
+}
+
+// EncodePNG writes the last rendered image as PNG, see EncodePNG.
+func (r *WidgetRenderer) EncodePNG(out io.Writer, level int) error {
+	return EncodePNG(out, r.pix, r.width, r.height, 3, level)
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  typedef struct Fl_Widget Fl_Widget;
+  typedef struct Fl_RGB_Image Fl_RGB_Image;
+
+  extern Fl_RGB_Image *go_fltk_render_widget(Fl_Widget *w, double scale);
+  extern const unsigned char *go_fltk_rendered_pixels(Fl_RGB_Image *img, int *w, int *h, int *d, int *ld);
+  extern void go_fltk_rendered_delete(Fl_RGB_Image *img);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,6 +5,8 @@
 #include <FL/platform.H>
 
 #include "event_handler.h"
+#include "fltk.h"
+#include "startup_trace.h"
 
 
 class GWindow : public EventHandler<Fl_Double_Window> {
@@ -13,6 +15,12 @@ public:
     : EventHandler<Fl_Double_Window>(w, h, title) {}
   GWindow(int x, int y, int w, int h, const char* title)
     : EventHandler<Fl_Double_Window>(x, y, w, h, title) {}
+
+  void flush() override {
+    go_fltk_ensure_fonts();
+    EventHandler<Fl_Double_Window>::flush();
+    startup_trace_first_frame();
+  }
 };
 
 GWindow *go_fltk_new_Window(int w, int h, const char* title) {
@@ -28,6 +36,7 @@ int go_fltk_Window_shown(Fl_Window *w) {
 }
 
 void go_fltk_Window_show(Fl_Window *w) {
+  StartupSpan span("show window");
   w->show();
 }
 